@@ -87,10 +87,192 @@ public:
 
     QString constructRelatedImagesSQL(bool fromOrTo, DatabaseRelation::Type type, bool boolean);
     QList<qlonglong> execRelatedImagesQuery(DbEngineSqlQuery& query, qlonglong id, DatabaseRelation::Type type);
+    QHash<qlonglong, QVariantList> execBatchedFieldsQuery(const QString& table, const QString& idColumn,
+                                                          const QStringList& fieldNames, const QList<qlonglong>& ids);
+    void execBatchedImageTagsQuery(const QString& statement, const QList<qlonglong>& imageIds, const QList<int>& tagIds);
+
+    qlonglong relationComponent(qlonglong imageId);
+    qlonglong buildRelationComponent(qlonglong imageId);
+    void      mergeRelationComponents(qlonglong subjectId, qlonglong objectId);
+    void      invalidateRelationComponent(qlonglong imageId);
+
+public:
+
+    /**
+     * Maximum number of bound values used in one "IN (...)" clause.
+     * SQLite refuses statements with more than 999 host parameters.
+     */
+    static const int     idBatchSize;
 };
 
 const QString CoreDB::Private::configGroupName(QLatin1String("CoreDB Settings"));
 const QString CoreDB::Private::configRecentlyUsedTags(QLatin1String("Recently Used Tags"));
+const int     CoreDB::Private::idBatchSize = 500;
+
+qlonglong CoreDB::Private::relationComponent(qlonglong imageId)
+{
+    QList<QVariant> values;
+
+    db->execSql(QString::fromUtf8("SELECT component FROM ImageRelationComponents WHERE imageid=?;"),
+                imageId, &values);
+
+    if (values.isEmpty())
+    {
+        return -1;
+    }
+
+    return values.first().toLongLong();
+}
+
+qlonglong CoreDB::Private::buildRelationComponent(qlonglong imageId)
+{
+    // Walk the DerivedFrom relations one level at a time. Removed images are not filtered out here:
+    // their relations still connect the versions, the status is checked when the relations are read.
+
+    QSet<qlonglong>  members;
+    QList<qlonglong> level;
+    members << imageId;
+    level   << imageId;
+
+    const int batchSize = idBatchSize / 2;
+
+    while (!level.isEmpty())
+    {
+        QList<qlonglong> next;
+
+        for (int start = 0 ; start < level.size() ; start += batchSize)
+        {
+            QList<qlonglong> batch = level.mid(start, batchSize);
+            QVariantList     ids;
+            QVariantList     values;
+            QString          placeholders;
+
+            CoreDB::addBoundValuePlaceholders(placeholders, batch.size());
+
+            foreach (const qlonglong& id, batch)
+            {
+                ids << id;
+            }
+
+            db->execSql(QString::fromUtf8("SELECT subject, object FROM ImageRelations "
+                                          "WHERE (subject IN (%1) OR object IN (%1)) AND type=?;").arg(placeholders),
+                        QVariantList() << ids << ids << (int)DatabaseRelation::DerivedFrom, &values);
+
+            foreach (const QVariant& value, values)
+            {
+                qlonglong id = value.toLongLong();
+
+                if (!members.contains(id))
+                {
+                    members << id;
+                    next    << id;
+                }
+            }
+        }
+
+        level = next;
+    }
+
+    // Images without relations are not stored.
+
+    if (members.size() == 1)
+    {
+        return -1;
+    }
+
+    // The smallest image id identifies the component.
+
+    qlonglong component = imageId;
+
+    foreach (const qlonglong& id, members)
+    {
+        component = qMin(component, id);
+    }
+
+    DbEngineSqlQuery query = db->prepareQuery(QString::fromUtf8("REPLACE INTO ImageRelationComponents (imageid, component) "
+                                                                "VALUES (?, ?);"));
+    QVariantList ids, components;
+
+    foreach (const qlonglong& id, members)
+    {
+        ids        << id;
+        components << component;
+    }
+
+    query.addBindValue(ids);
+    query.addBindValue(components);
+    db->execBatch(query);
+
+    return component;
+}
+
+void CoreDB::Private::mergeRelationComponents(qlonglong subjectId, qlonglong objectId)
+{
+    qlonglong subjectComponent = relationComponent(subjectId);
+    qlonglong objectComponent  = relationComponent(objectId);
+
+    if (subjectComponent == objectComponent)
+    {
+        // Same component, or both not stored yet: they are built when they are needed.
+        return;
+    }
+
+    if ((subjectComponent != -1) && (objectComponent != -1))
+    {
+        db->execSql(QString::fromUtf8("UPDATE ImageRelationComponents SET component=? WHERE component=?;"),
+                    qMin(subjectComponent, objectComponent), qMax(subjectComponent, objectComponent));
+        return;
+    }
+
+    qlonglong component = (subjectComponent != -1) ? subjectComponent : objectComponent;
+    qlonglong newId     = (subjectComponent != -1) ? objectId         : subjectId;
+    qlonglong knownId   = (subjectComponent != -1) ? subjectId        : objectId;
+
+    // The new image joins the known component if this relation is its only link.
+    // Otherwise, it can connect other images and the joined component is built again when it is needed.
+
+    QList<QVariant> values;
+
+    db->execSql(QString::fromUtf8("SELECT subject, object FROM ImageRelations "
+                                  "WHERE (subject=? OR object=?) AND type=?;"),
+                newId, newId, (int)DatabaseRelation::DerivedFrom, &values);
+
+    foreach (const QVariant& value, values)
+    {
+        qlonglong id = value.toLongLong();
+
+        if ((id != newId) && (id != knownId))
+        {
+            db->execSql(QString::fromUtf8("DELETE FROM ImageRelationComponents WHERE component=?;"),
+                        component);
+            return;
+        }
+    }
+
+    if (newId < component)
+    {
+        db->execSql(QString::fromUtf8("UPDATE ImageRelationComponents SET component=? WHERE component=?;"),
+                    newId, component);
+        component = newId;
+    }
+
+    db->execSql(QString::fromUtf8("REPLACE INTO ImageRelationComponents (imageid, component) "
+                                  "VALUES (?, ?);"),
+                newId, component);
+}
+
+void CoreDB::Private::invalidateRelationComponent(qlonglong imageId)
+{
+    // A removed relation can split the component, it is built again when it is needed.
+
+    qlonglong component = relationComponent(imageId);
+
+    if (component != -1)
+    {
+        db->execSql(QString::fromUtf8("DELETE FROM ImageRelationComponents WHERE component=?;"),
+                    component);
+    }
+}
 
 QString CoreDB::Private::constructRelatedImagesSQL(bool fromOrTo, DatabaseRelation::Type type, bool boolean)
 {
@@ -158,6 +340,83 @@ QList<qlonglong> CoreDB::Private::execRelatedImagesQuery(DbEngineSqlQuery& query
     return imageIds;
 }
 
+QHash<qlonglong, QVariantList> CoreDB::Private::execBatchedFieldsQuery(const QString& table, const QString& idColumn,
+                                                                        const QStringList& fieldNames, const QList<qlonglong>& ids)
+{
+    QHash<qlonglong, QVariantList> results;
+
+    if (ids.isEmpty() || fieldNames.isEmpty())
+    {
+        return results;
+    }
+
+    results.reserve(ids.size());
+    const int columns = fieldNames.size() + 1;
+
+    for (int start = 0 ; start < ids.size() ; start += idBatchSize)
+    {
+        QList<qlonglong> batch = ids.mid(start, idBatchSize);
+        QVariantList     boundValues;
+        QVariantList     values;
+
+        QString query = QString::fromUtf8("SELECT %1, %2 FROM %3 WHERE %1 IN (")
+                        .arg(idColumn, fieldNames.join(QString::fromUtf8(", ")), table);
+        CoreDB::addBoundValuePlaceholders(query, batch.size());
+        query        += QString::fromUtf8(");");
+
+        foreach (const qlonglong& id, batch)
+        {
+            boundValues << id;
+        }
+
+        db->execSql(query, boundValues, &values);
+
+        for (int i = 0 ; i + columns <= values.size() ; i += columns)
+        {
+            results.insert(values.at(i).toLongLong(), values.mid(i + 1, columns - 1));
+        }
+    }
+
+    return results;
+}
+
+void CoreDB::Private::execBatchedImageTagsQuery(const QString& statement,
+                                                 const QList<qlonglong>& imageIds, const QList<int>& tagIds)
+{
+    // The statement has two "IN (%1)" clauses, for the image ids and the tag ids.
+    // Both lists are cut so that a query never uses more than idBatchSize bound values.
+
+    const int batchSize = idBatchSize / 2;
+
+    for (int tagStart = 0 ; tagStart < tagIds.size() ; tagStart += batchSize)
+    {
+        QList<int> tagBatch = tagIds.mid(tagStart, batchSize);
+
+        for (int start = 0 ; start < imageIds.size() ; start += batchSize)
+        {
+            QList<qlonglong> batch = imageIds.mid(start, batchSize);
+            QVariantList     boundValues;
+            QString          imagePlaceholders;
+            QString          tagPlaceholders;
+
+            CoreDB::addBoundValuePlaceholders(imagePlaceholders, batch.size());
+            CoreDB::addBoundValuePlaceholders(tagPlaceholders,   tagBatch.size());
+
+            foreach (const qlonglong& id, batch)
+            {
+                boundValues << id;
+            }
+
+            foreach (int id, tagBatch)
+            {
+                boundValues << id;
+            }
+
+            db->execSql(statement.arg(imagePlaceholders, tagPlaceholders), boundValues);
+        }
+    }
+}
+
 // --------------------------------------------------------
 
 CoreDB::CoreDB(CoreDbBackend* const backend)
@@ -1345,17 +1604,45 @@ QVector<QList<int> > CoreDB::getItemsTagIDs(const QList<qlonglong> imageIds)
     }
 
     QVector<QList<int> > results(imageIds.size());
-    DbEngineSqlQuery query = d->db->prepareQuery(QString::fromUtf8("SELECT tagid FROM ImageTags WHERE imageID=?;"));
-    QVariantList values;
+    QHash<qlonglong, int> indexes;
+    indexes.reserve(imageIds.size());
 
     for (int i = 0 ; i < imageIds.size() ; ++i)
     {
-        d->db->execSql(query, imageIds[i], &values);
-        QList<int>& tagIds = results[i];
+        indexes.insertMulti(imageIds.at(i), i);
+    }
+
+    // One query per batch of ids instead of one query per id.
+
+    for (int start = 0 ; start < imageIds.size() ; start += Private::idBatchSize)
+    {
+        QList<qlonglong> batch = imageIds.mid(start, Private::idBatchSize);
+        QVariantList     boundValues;
+        QVariantList     values;
+
+        QString query = QString::fromUtf8("SELECT imageid, tagid FROM ImageTags WHERE imageid IN (");
+        addBoundValuePlaceholders(query, batch.size());
+        query        += QString::fromUtf8(");");
 
-        foreach (const QVariant& v, values)
+        foreach (const qlonglong& id, batch)
         {
-            tagIds << v.toInt();
+            boundValues << id;
+        }
+
+        d->db->execSql(query, boundValues, &values);
+
+        for (QList<QVariant>::const_iterator it = values.constBegin() ; it != values.constEnd() ; )
+        {
+            qlonglong imageId = (*it).toLongLong();
+            ++it;
+            int tagId         = (*it).toInt();
+            ++it;
+
+            // The same id may be listed more than once by the caller.
+            foreach (int index, indexes.values(imageId))
+            {
+                results[index] << tagId;
+            }
         }
     }
 
@@ -1646,6 +1933,65 @@ QVariantList CoreDB::getItemInformation(qlonglong imageID, DatabaseFields::ItemI
     return values;
 }
 
+QHash<qlonglong, QVariantList> CoreDB::getItemsImagesFields(const QList<qlonglong>& imageIDs, DatabaseFields::Images fields)
+{
+    if (fields == DatabaseFields::ImagesNone)
+    {
+        return QHash<qlonglong, QVariantList>();
+    }
+
+    QStringList fieldNames                 = imagesFieldList(fields);
+    QHash<qlonglong, QVariantList> results = d->execBatchedFieldsQuery(QLatin1String("Images"), QLatin1String("id"),
+                                                                       fieldNames, imageIDs);
+
+    // Convert date times to QDateTime, they come as QString
+    if (fields & DatabaseFields::ModificationDate)
+    {
+        int index = fieldNames.indexOf(QLatin1String("modificationDate"));
+
+        for (QHash<qlonglong, QVariantList>::iterator it = results.begin() ; it != results.end() ; ++it)
+        {
+            (*it)[index] = it->at(index).toDateTime();
+        }
+    }
+
+    return results;
+}
+
+QHash<qlonglong, QVariantList> CoreDB::getItemsInformation(const QList<qlonglong>& imageIDs, DatabaseFields::ItemInformation fields)
+{
+    if (fields == DatabaseFields::ItemInformationNone)
+    {
+        return QHash<qlonglong, QVariantList>();
+    }
+
+    QStringList fieldNames                 = imageInformationFieldList(fields);
+    QHash<qlonglong, QVariantList> results = d->execBatchedFieldsQuery(QLatin1String("ImageInformation"), QLatin1String("imageid"),
+                                                                       fieldNames, imageIDs);
+
+    // Convert date times to QDateTime, they come as QString
+    int creationIndex     = (fields & DatabaseFields::CreationDate)     ? fieldNames.indexOf(QLatin1String("creationDate"))     : -1;
+    int digitizationIndex = (fields & DatabaseFields::DigitizationDate) ? fieldNames.indexOf(QLatin1String("digitizationDate")) : -1;
+
+    if (creationIndex != -1 || digitizationIndex != -1)
+    {
+        for (QHash<qlonglong, QVariantList>::iterator it = results.begin() ; it != results.end() ; ++it)
+        {
+            if (creationIndex != -1)
+            {
+                (*it)[creationIndex] = it->at(creationIndex).toDateTime();
+            }
+
+            if (digitizationIndex != -1)
+            {
+                (*it)[digitizationIndex] = it->at(digitizationIndex).toDateTime();
+            }
+        }
+    }
+
+    return results;
+}
+
 QVariantList CoreDB::getImageMetadata(qlonglong imageID, DatabaseFields::ImageMetadata fields)
 {
     QVariantList values;
@@ -2347,6 +2693,12 @@ void CoreDB::addImageRelation(qlonglong subjectId, qlonglong objectId, DatabaseR
     d->db->execSql(QString::fromUtf8("REPLACE INTO ImageRelations (subject, object, type) "
                                      "VALUES (?, ?, ?);"),
                    subjectId, objectId, type);
+
+    if (type == DatabaseRelation::DerivedFrom)
+    {
+        d->mergeRelationComponents(subjectId, objectId);
+    }
+
     d->db->recordChangeset(ImageChangeset(QList<qlonglong>() << subjectId << objectId,
                                           DatabaseFields::Set(DatabaseFields::ImageRelations)));
 }
@@ -2370,6 +2722,15 @@ void CoreDB::addImageRelations(const QList<qlonglong>& subjectIds,
     query.addBindValue(objects);
     query.addBindValue(types);
     d->db->execBatch(query);
+
+    if (type == DatabaseRelation::DerivedFrom)
+    {
+        for (int i = 0 ; i < subjectIds.size() ; ++i)
+        {
+            d->mergeRelationComponents(subjectIds.at(i), objectIds.at(i));
+        }
+    }
+
     d->db->recordChangeset(ImageChangeset(subjectIds + objectIds,
                                           DatabaseFields::Set(DatabaseFields::ImageRelations)));
 }
@@ -2384,6 +2745,12 @@ void CoreDB::removeImageRelation(qlonglong subjectId, qlonglong objectId, Databa
 {
     d->db->execSql(QString::fromUtf8("DELETE FROM ImageRelations WHERE subject=? AND object=? AND type=?;"),
                    subjectId, objectId, type);
+
+    if (type == DatabaseRelation::DerivedFrom)
+    {
+        d->invalidateRelationComponent(subjectId);
+    }
+
     d->db->recordChangeset(ImageChangeset(QList<qlonglong>() << subjectId << objectId,
                                           DatabaseFields::Set(DatabaseFields::ImageRelations)));
 }
@@ -2404,6 +2771,12 @@ QList<qlonglong> CoreDB::removeAllImageRelationsTo(qlonglong objectId, DatabaseR
 
     d->db->execSql(QString::fromUtf8("DELETE FROM ImageRelations WHERE object=? AND type=?;"),
                    objectId, type);
+
+    if (type == DatabaseRelation::DerivedFrom)
+    {
+        d->invalidateRelationComponent(objectId);
+    }
+
     d->db->recordChangeset(ImageChangeset(QList<qlonglong>() << affected << objectId,
                                           DatabaseFields::Set(DatabaseFields::ImageRelations)));
 
@@ -2421,6 +2794,12 @@ QList<qlonglong> CoreDB::removeAllImageRelationsFrom(qlonglong subjectId, Databa
 
     d->db->execSql(QString::fromUtf8("DELETE FROM ImageRelations WHERE subject=? AND type=?;"),
                    subjectId, type);
+
+    if (type == DatabaseRelation::DerivedFrom)
+    {
+        d->invalidateRelationComponent(subjectId);
+    }
+
     d->db->recordChangeset(ImageChangeset(QList<qlonglong>() << affected << subjectId, 
                                           DatabaseFields::Set(DatabaseFields::ImageRelations)));
 
@@ -2487,8 +2866,27 @@ QVector<QList<qlonglong> > CoreDB::getRelatedImages(QList<qlonglong> ids,
     return result;
 }
 
+qlonglong CoreDB::getImageRelationComponent(qlonglong imageId)
+{
+    qlonglong component = d->relationComponent(imageId);
+
+    if (component == -1)
+    {
+        component = d->buildRelationComponent(imageId);
+    }
+
+    // An image without relations is its own component.
+
+    return (component == -1) ? imageId : component;
+}
+
 QList<QPair<qlonglong, qlonglong> > CoreDB::getRelationCloud(qlonglong imageId, DatabaseRelation::Type type)
 {
+    if (type == DatabaseRelation::DerivedFrom)
+    {
+        return getDerivedFromCloud(imageId);
+    }
+
     QSet<qlonglong> todo, done;
     QSet<QPair<qlonglong, qlonglong> > pairs;
     todo << imageId;
@@ -2555,6 +2953,166 @@ QList<QPair<qlonglong, qlonglong> > CoreDB::getRelationCloud(qlonglong imageId,
     return pairs.toList();
 }
 
+QList<QPair<qlonglong, qlonglong> > CoreDB::getDerivedFromCloud(qlonglong imageId)
+{
+    QList<QPair<qlonglong, qlonglong> > relations;
+    qlonglong component = d->relationComponent(imageId);
+
+    if (component == -1)
+    {
+        component = d->buildRelationComponent(imageId);
+
+        if (component == -1)
+        {
+            return relations;
+        }
+    }
+
+    // All the relations of the component are read with one query, with the components of both ends.
+    // Older versions do not maintain the components: if a relation leaves the component,
+    // the stored components are outdated and they are built again.
+
+    const QString sql = QString::fromUtf8("SELECT subject, object, SubjectComponents.component, ObjectComponents.component "
+                                          "FROM ImageRelations "
+                                          "INNER JOIN ImageRelationComponents AS SubjectComponents "
+                                          "ON ImageRelations.subject=SubjectComponents.imageid "
+                                          " LEFT JOIN ImageRelationComponents AS ObjectComponents "
+                                          " ON ImageRelations.object=ObjectComponents.imageid "
+                                          "  INNER JOIN Images AS SubjectImages "
+                                          "  ON ImageRelations.subject=SubjectImages.id "
+                                          "   INNER JOIN Images AS ObjectImages "
+                                          "   ON ImageRelations.object=ObjectImages.id "
+                                          "    WHERE SubjectComponents.component=? AND type=? "
+                                          "     AND SubjectImages.status!=3 "
+                                          "     AND ObjectImages.status!=3 "
+                                          "UNION "
+                                          "SELECT subject, object, SubjectComponents.component, ObjectComponents.component "
+                                          "FROM ImageRelations "
+                                          "INNER JOIN ImageRelationComponents AS ObjectComponents "
+                                          "ON ImageRelations.object=ObjectComponents.imageid "
+                                          " LEFT JOIN ImageRelationComponents AS SubjectComponents "
+                                          " ON ImageRelations.subject=SubjectComponents.imageid "
+                                          "  INNER JOIN Images AS SubjectImages "
+                                          "  ON ImageRelations.subject=SubjectImages.id "
+                                          "   INNER JOIN Images AS ObjectImages "
+                                          "   ON ImageRelations.object=ObjectImages.id "
+                                          "    WHERE ObjectComponents.component=? AND type=? "
+                                          "     AND SubjectImages.status!=3 "
+                                          "     AND ObjectImages.status!=3;");
+
+    for (bool rebuilt = false ; ; rebuilt = true)
+    {
+        QList<QVariant> values;
+        QSet<qlonglong> outdated;
+
+        d->db->execSql(sql, component, (int)DatabaseRelation::DerivedFrom,
+                       component, (int)DatabaseRelation::DerivedFrom, &values);
+
+        relations.clear();
+
+        for (QList<QVariant>::const_iterator it = values.constBegin() ; it != values.constEnd() ; )
+        {
+            qlonglong subject         = (*it).toLongLong();
+            ++it;
+            qlonglong object          = (*it).toLongLong();
+            ++it;
+            QVariant subjectComponent = *it;
+            ++it;
+            QVariant objectComponent  = *it;
+            ++it;
+
+            if (subjectComponent.isNull() || objectComponent.isNull() ||
+                (subjectComponent.toLongLong() != component) || (objectComponent.toLongLong() != component))
+            {
+                outdated << component;
+
+                if (!subjectComponent.isNull())
+                {
+                    outdated << subjectComponent.toLongLong();
+                }
+
+                if (!objectComponent.isNull())
+                {
+                    outdated << objectComponent.toLongLong();
+                }
+            }
+
+            relations << qMakePair(subject, object);
+        }
+
+        if (outdated.isEmpty() || rebuilt)
+        {
+            break;
+        }
+
+        qCDebug(DIGIKAM_DATABASE_LOG) << "Image relation components" << outdated << "are outdated, building them again";
+
+        foreach (const qlonglong& id, outdated)
+        {
+            d->db->execSql(QString::fromUtf8("DELETE FROM ImageRelationComponents WHERE component=?;"),
+                           id);
+        }
+
+        component = d->buildRelationComponent(imageId);
+
+        if (component == -1)
+        {
+            relations.clear();
+            return relations;
+        }
+    }
+
+    QMultiHash<qlonglong, int> relationsByImage;
+
+    for (int i = 0 ; i < relations.size() ; ++i)
+    {
+        relationsByImage.insert(relations.at(i).first,  i);
+        relationsByImage.insert(relations.at(i).second, i);
+    }
+
+    // The component can hold images which are not connected anymore, or only through removed images:
+    // keep the relations reachable from the image, as the cloud is walked in getRelationCloud().
+
+    QList<qlonglong> todo;
+    QSet<qlonglong>  done;
+    QSet<int>        reached;
+    todo << imageId;
+    done << imageId;
+
+    while (!todo.isEmpty())
+    {
+        qlonglong id = todo.takeFirst();
+
+        foreach (int index, relationsByImage.values(id))
+        {
+            reached << index;
+
+            const QPair<qlonglong, qlonglong>& relation = relations.at(index);
+
+            if (!done.contains(relation.first))
+            {
+                done << relation.first;
+                todo << relation.first;
+            }
+
+            if (!done.contains(relation.second))
+            {
+                done << relation.second;
+                todo << relation.second;
+            }
+        }
+    }
+
+    QList<QPair<qlonglong, qlonglong> > cloud;
+
+    foreach (int index, reached)
+    {
+        cloud << relations.at(index);
+    }
+
+    return cloud;
+}
+
 QList<qlonglong> CoreDB::getOneRelatedImageEach(const QList<qlonglong>& ids, DatabaseRelation::Type type)
 {
     QString sql = QString::fromUtf8("SELECT subject, object FROM ImageRelations "
@@ -3198,18 +3756,7 @@ void CoreDB::addItemTag(qlonglong imageID, int tagID)
 
     d->db->recordChangeset(ImageTagChangeset(imageID, tagID, ImageTagChangeset::Added));
 
-    //don't save pick or color tags
-    if (TagsCache::instance()->isInternalTag(tagID))
-        return;
-
-    //move current tag to front
-    d->recentlyAssignedTags.removeAll(tagID);
-    d->recentlyAssignedTags.prepend(tagID);
-
-    if (d->recentlyAssignedTags.size() > 10)
-    {
-        d->recentlyAssignedTags.removeLast();
-    }
+    addRecentlyAssignedTags(QList<int>() << tagID);
 }
 
 void CoreDB::addItemTag(int albumID, const QString& name, int tagID)
@@ -3234,26 +3781,62 @@ void CoreDB::addTagsToItems(QList<qlonglong> imageIDs, QList<int> tagIDs)
         return;
     }
 
-    DbEngineSqlQuery query = d->db->prepareQuery(QString::fromUtf8("REPLACE INTO ImageTags (imageid, tagid) "
-                                                                   "VALUES(?, ?);"));
-    QVariantList images;
-    QVariantList tags;
+    // Multi-row statements, each inserting up to idBatchSize / 2 (imageid, tagid) pairs,
+    // all run in one transaction.
+
+    const int    pairsPerQuery = Private::idBatchSize / 2;
+    QVariantList boundValues;
+
+    d->db->beginTransaction();
 
     foreach (const qlonglong& imageid, imageIDs)
     {
         foreach (int tagid, tagIDs)
         {
-            images << imageid;
-            tags << tagid;
+            boundValues << imageid << tagid;
+
+            if (boundValues.size() == 2 * pairsPerQuery)
+            {
+                QString query = QString::fromUtf8("REPLACE INTO ImageTags (imageid, tagid) VALUES ");
+                query        += QString::fromUtf8("(?,?),").repeated(pairsPerQuery);
+                query.chop(1);
+                d->db->execSql(query, boundValues);
+                boundValues.clear();
+            }
         }
     }
 
-    query.addBindValue(images);
-    query.addBindValue(tags);
-    d->db->execBatch(query);
+    if (!boundValues.isEmpty())
+    {
+        QString query = QString::fromUtf8("REPLACE INTO ImageTags (imageid, tagid) VALUES ");
+        query        += QString::fromUtf8("(?,?),").repeated(boundValues.size() / 2);
+        query.chop(1);
+        d->db->execSql(query, boundValues);
+    }
+
+    d->db->commitTransaction();
     d->db->recordChangeset(ImageTagChangeset(imageIDs, tagIDs, ImageTagChangeset::Added));
 }
 
+void CoreDB::addRecentlyAssignedTags(const QList<int>& tagIDs)
+{
+    foreach (int tagID, tagIDs)
+    {
+        //don't save pick or color tags
+        if (TagsCache::instance()->isInternalTag(tagID))
+            continue;
+
+        //move current tag to front
+        d->recentlyAssignedTags.removeAll(tagID);
+        d->recentlyAssignedTags.prepend(tagID);
+
+        if (d->recentlyAssignedTags.size() > 10)
+        {
+            d->recentlyAssignedTags.removeLast();
+        }
+    }
+}
+
 QList<int> CoreDB::getRecentlyAssignedTags() const
 {
     return d->recentlyAssignedTags;
@@ -3284,23 +3867,27 @@ void CoreDB::removeTagsFromItems(QList<qlonglong> imageIDs, const QList<int>& ta
         return;
     }
 
-    DbEngineSqlQuery     query = d->db->prepareQuery(QString::fromUtf8("DELETE FROM ImageTags WHERE imageID=? AND tagid=?;"));
-    QVariantList images;
-    QVariantList tags;
+    d->db->beginTransaction();
+    d->execBatchedImageTagsQuery(QString::fromUtf8("DELETE FROM ImageTags "
+                                                   "WHERE imageid IN (%1) AND tagid IN (%2);"),
+                                 imageIDs, tagIDs);
+    d->db->commitTransaction();
+    d->db->recordChangeset(ImageTagChangeset(imageIDs, tagIDs, ImageTagChangeset::Removed));
+}
 
-    foreach (const qlonglong& imageid, imageIDs)
+void CoreDB::removeTagPropertiesFromItems(const QList<qlonglong>& imageIDs, const QList<int>& tagIDs)
+{
+    if (imageIDs.isEmpty() || tagIDs.isEmpty())
     {
-        foreach (int tagid, tagIDs)
-        {
-            images << imageid;
-            tags << tagid;
-        }
+        return;
     }
 
-    query.addBindValue(images);
-    query.addBindValue(tags);
-    d->db->execBatch(query);
-    d->db->recordChangeset(ImageTagChangeset(imageIDs, tagIDs, ImageTagChangeset::Removed));
+    d->db->beginTransaction();
+    d->execBatchedImageTagsQuery(QString::fromUtf8("DELETE FROM ImageTagProperties "
+                                                   "WHERE imageid IN (%1) AND tagid IN (%2);"),
+                                 imageIDs, tagIDs);
+    d->db->commitTransaction();
+    d->db->recordChangeset(ImageTagChangeset(imageIDs, tagIDs, ImageTagChangeset::PropertiesChanged));
 }
 
 QStringList CoreDB::getItemNamesInAlbum(int albumID, bool recursive)
@@ -4819,6 +5406,8 @@ void CoreDB::copyImageAttributes(qlonglong srcId, qlonglong dstId)
                                     "SELECT subject, ?, type "
                                     "FROM ImageRelations WHERE object=?;"),
                    dstId, srcId);
+    d->invalidateRelationComponent(srcId);
+    d->invalidateRelationComponent(dstId);
     fields |= DatabaseFields::ImageRelations;
 
     d->db->recordChangeset(ImageChangeset(dstId, fields));
@@ -35,6 +35,7 @@
 #include <QDateTime>
 #include <QPair>
 #include <QMap>
+#include <QHash>
 #include <QUuid>
 
 // Local includes
@@ -792,6 +793,15 @@ public:
      */
     QVariantList getImagesFields(qlonglong imageID, DatabaseFields::Images imagesFields);
 
+    /**
+     * For a list of items, return the requested fields from the Images table.
+     * Amounts to calling getImagesFields for each id in imageIDs, but the ids
+     * are queried in batches with one "IN (...)" statement per batch.
+     * Ids without an entry are not contained in the returned hash.
+     */
+    QHash<qlonglong, QVariantList> getItemsImagesFields(const QList<qlonglong>& imageIDs,
+                                                        DatabaseFields::Images imagesFields);
+
     /**
      * Add (or replace) the ItemInformation of the specified item.
      * If there is already an entry, it will be discarded.
@@ -827,6 +837,13 @@ public:
     QVariantList getItemInformation(qlonglong imageID,
                                      DatabaseFields::ItemInformation infoFields = DatabaseFields::ItemInformationAll);
 
+    /**
+     * For a list of items, read image information. Amounts to calling
+     * getItemInformation for each id in imageIDs, but is optimized as above.
+     */
+    QHash<qlonglong, QVariantList> getItemsInformation(const QList<qlonglong>& imageIDs,
+                                                       DatabaseFields::ItemInformation infoFields = DatabaseFields::ItemInformationAll);
+
     /**
      * Add (or replace) the ImageMetadata of the specified item.
      * If there is already an entry, it will be discarded.
@@ -1105,6 +1122,14 @@ public:
     QList<QPair<qlonglong, qlonglong> > getRelationCloud(qlonglong imageId,
             DatabaseRelation::Type type = DatabaseRelation::UndefinedType);
 
+    /**
+     * Returns the id of the connected component of DerivedFrom relations holding the given image.
+     * The id is the smallest image id of the component, an image without relations is its own component.
+     * The components are stored in the ImageRelationComponents table, and built there on first use.
+     * Images without relations are not stored.
+     */
+    qlonglong getImageRelationComponent(qlonglong imageId);
+
     /**
      * For each of the given ids, find one single related image (direction does not matter).
      * Ids are unique in the returned list, and do not correspond by index to the given list.
@@ -1162,9 +1187,17 @@ public:
     /**
      * Add each tag of a list of tags
      * to each member of a list of items.
+     * All rows are inserted in one transaction with multi-row statements,
+     * and one changeset is recorded for all the items.
      */
     void addTagsToItems(QList<qlonglong> imageIDs, QList<int> tagIDs);
 
+    /**
+     * Move the tags to the front of the recently assigned tags.
+     * Internal tags, as pick and color labels, are ignored.
+     */
+    void addRecentlyAssignedTags(const QList<int>& tagIDs);
+
     /**
      * Remove a specific tag for the item
      * @param imageID the ID of the item
@@ -1182,9 +1215,17 @@ public:
     /**
      * Remove each tag from a list of tags
      * from a each member of a list of items.
+     * All rows are removed in one transaction,
+     * and one changeset is recorded for all the items.
      */
     void removeTagsFromItems(QList<qlonglong> imageIDs, const QList<int>& tagIDs);
 
+    /**
+     * Remove the properties of each tag from a list of tags
+     * from each member of a list of items.
+     */
+    void removeTagPropertiesFromItems(const QList<qlonglong>& imageIDs, const QList<int>& tagIDs);
+
     /**
      * Get a list of names of all the tags for the item
      * @param imageID the ID of the item
@@ -1384,6 +1425,7 @@ protected:
 
     QList<qlonglong> getRelatedImages(qlonglong id, bool fromOrTo, DatabaseRelation::Type type, bool boolean);
     QVector<QList<qlonglong> > getRelatedImages(QList<qlonglong> ids, bool fromOrTo, DatabaseRelation::Type type, bool boolean);
+    QList<QPair<qlonglong, qlonglong> > getDerivedFromCloud(qlonglong imageId);
 
 private:
 
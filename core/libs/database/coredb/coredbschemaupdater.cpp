@@ -56,7 +56,7 @@ namespace Digikam
 
 int CoreDbSchemaUpdater::schemaVersion()
 {
-    return 10;
+    return 11;
 }
 
 int CoreDbSchemaUpdater::filterSettingsVersion()
@@ -550,7 +550,9 @@ bool CoreDbSchemaUpdater::createDatabase()
 
         // if we start with the V2 hash, version 6 is required
         d->albumDB->setUniqueHashVersion(uniqueHashVersion());
-        d->currentRequiredVersion = schemaVersion();
+
+        // Digikam for database version 10 can work with version 11, ImageRelationComponents is only a cache
+        d->currentRequiredVersion = 10;
 /*
         // Digikam for database version 5 can work with version 6, though not using the new features
         d->currentRequiredVersion = 5;
@@ -690,6 +692,10 @@ bool CoreDbSchemaUpdater::updateToVersion(int targetVersion)
         case 10:
             // Digikam for database version 9 can work with version 10, remove ImageHaarMatrix table and add manualOrder column.
             return performUpdateToVersion(QLatin1String("UpdateSchemaFromV9ToV10"), 10, 5);
+        case 11:
+            // Digikam for database version 10 can work with version 11, add ImageRelationComponents table.
+            // Older versions do not keep it up to date, the components are checked when they are read.
+            return performUpdateToVersion(QLatin1String("UpdateSchemaFromV10ToV11"), 11, 5);
         default:
             qCDebug(DIGIKAM_COREDB_LOG) << "Core database: unsupported update to version" << targetVersion;
             return false;
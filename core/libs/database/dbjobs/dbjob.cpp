@@ -46,6 +46,11 @@ DBJob::~DBJob()
     this->cancel();
 }
 
+bool DBJob::isCanceled()
+{
+    return m_cancel;
+}
+
 // ----------------------------------------------
 
 AlbumsJob::AlbumsJob(const AlbumsDBJobInfo& jobInfo)
@@ -252,11 +257,16 @@ void SearchesJob::run()
         ItemLister lister;
         lister.setListOnlyAvailable(m_jobInfo.isListAvailableImagesOnly());
 
-        // Send data every 200 images to be more responsive
-        ItemListerJobPartsSendingReceiver receiver(this, 200);
+        // Send the first 200 images at once to fill the view, then grow the parts up to 2000 images.
+        ItemListerJobGrowingPartsSendingReceiver receiver(this, 200, 2000, 200);
 
         foreach (const SearchInfo& info, infos)
         {
+            if (m_cancel)
+            {
+                break;
+            }
+
             if (info.type == DatabaseSearch::HaarSearch)
             {
                 lister.listHaarSearch(&receiver, info.query);
@@ -276,7 +286,7 @@ void SearchesJob::run()
                 }
             }
 
-            if (!receiver.hasError)
+            if (!receiver.hasError && !m_cancel)
             {
                 receiver.sendData();
             }
@@ -323,9 +333,5 @@ void SearchesJob::run()
     emit signalDone();
 }
 
-bool SearchesJob::isCanceled()
-{
-    return m_cancel;
-}
 
 } // namespace Digikam
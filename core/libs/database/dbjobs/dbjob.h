@@ -42,6 +42,12 @@ class DIGIKAM_DATABASE_EXPORT DBJob : public ActionJob
 {
     Q_OBJECT
 
+public:
+
+    /** Return true if the job was canceled. Long listings check it between the records.
+     */
+    bool isCanceled();
+
 protected:
 
     explicit DBJob();
@@ -161,8 +167,6 @@ public:
     explicit SearchesJob(const SearchesDBJobInfo& jobInfo);
     ~SearchesJob();
 
-    bool isCanceled();
-
 Q_SIGNALS:
 
     void processedSize(int);
@@ -31,6 +31,7 @@
 #include <QFile>
 #include <QFileInfo>
 #include <QHash>
+#include <QSet>
 
 // Local includes
 
@@ -800,6 +801,217 @@ void ItemInfoList::loadTagIds() const
     }
 }
 
+void ItemInfoList::loadDatabaseFields(const DatabaseFields::Set& fields) const
+{
+    // Only the fields which are kept in ItemInfoData can be prefetched.
+
+    DatabaseFields::Images imagesFields                = fields.getImages() &
+                                                         (DatabaseFields::Category         |
+                                                          DatabaseFields::ModificationDate |
+                                                          DatabaseFields::FileSize         |
+                                                          DatabaseFields::UniqueHash       |
+                                                          DatabaseFields::ManualOrder);
+
+    DatabaseFields::ItemInformation informationFields = fields.getItemInformation() &
+                                                         (DatabaseFields::Rating           |
+                                                          DatabaseFields::CreationDate     |
+                                                          DatabaseFields::Format           |
+                                                          DatabaseFields::Width            |
+                                                          DatabaseFields::Height);
+
+    if (informationFields & (DatabaseFields::Width | DatabaseFields::Height))
+    {
+        informationFields |= DatabaseFields::Width | DatabaseFields::Height;
+    }
+
+    if (fields.getItemInformation() & (DatabaseFields::ColorLabel | DatabaseFields::PickLabel))
+    {
+        loadTagIds();
+    }
+
+    if (imagesFields == DatabaseFields::ImagesNone && informationFields == DatabaseFields::ItemInformationNone)
+    {
+        return;
+    }
+
+    QList<qlonglong> imagesIds;
+    QList<qlonglong> informationIds;
+
+    foreach (const ItemInfo& info, *this)
+    {
+        if (!info.m_data)
+        {
+            continue;
+        }
+
+        const ItemInfoData* const data = info.m_data.constData();
+
+        if (((imagesFields & DatabaseFields::Category)         && !data->categoryCached)         ||
+            ((imagesFields & DatabaseFields::ModificationDate) && !data->modificationDateCached) ||
+            ((imagesFields & DatabaseFields::FileSize)         && !data->fileSizeCached)         ||
+            ((imagesFields & DatabaseFields::UniqueHash)       && !data->uniqueHashCached)       ||
+            ((imagesFields & DatabaseFields::ManualOrder)      && !data->manualOrderCached))
+        {
+            imagesIds << data->id;
+        }
+
+        if (((informationFields & DatabaseFields::Rating)       && !data->ratingCached)       ||
+            ((informationFields & DatabaseFields::CreationDate) && !data->creationDateCached) ||
+            ((informationFields & DatabaseFields::Format)       && !data->formatCached)       ||
+            ((informationFields & DatabaseFields::Width)        && !data->imageSizeCached))
+        {
+            informationIds << data->id;
+        }
+    }
+
+    QHash<qlonglong, QVariantList> imagesValues;
+    QHash<qlonglong, QVariantList> informationValues;
+    QStringList imagesFieldNames      = CoreDB::imagesFieldList(imagesFields);
+    QStringList informationFieldNames = CoreDB::imageInformationFieldList(informationFields);
+
+    {
+        CoreDbAccess access;
+
+        if (!imagesIds.isEmpty())
+        {
+            imagesValues      = access.db()->getItemsImagesFields(imagesIds, imagesFields);
+        }
+
+        if (!informationIds.isEmpty())
+        {
+            informationValues = access.db()->getItemsInformation(informationIds, informationFields);
+        }
+    }
+
+    const int categoryIndex     = imagesFieldNames.indexOf(QLatin1String("category"));
+    const int modDateIndex      = imagesFieldNames.indexOf(QLatin1String("modificationDate"));
+    const int fileSizeIndex     = imagesFieldNames.indexOf(QLatin1String("fileSize"));
+    const int uniqueHashIndex   = imagesFieldNames.indexOf(QLatin1String("uniqueHash"));
+    const int manualOrderIndex  = imagesFieldNames.indexOf(QLatin1String("manualOrder"));
+    const int ratingIndex       = informationFieldNames.indexOf(QLatin1String("rating"));
+    const int creationDateIndex = informationFieldNames.indexOf(QLatin1String("creationDate"));
+    const int formatIndex       = informationFieldNames.indexOf(QLatin1String("format"));
+    const int widthIndex        = informationFieldNames.indexOf(QLatin1String("width"));
+    const int heightIndex       = informationFieldNames.indexOf(QLatin1String("height"));
+
+    const QSet<qlonglong> imagesIdSet      = imagesIds.toSet();
+    const QSet<qlonglong> informationIdSet = informationIds.toSet();
+
+    ItemInfoWriteLocker lock;
+
+    foreach (const ItemInfo& info, *this)
+    {
+        if (!info.m_data)
+        {
+            continue;
+        }
+
+        ItemInfoData* const data = info.m_data.constCastData();
+
+        // As in the single-item getters, a missing row still marks the field as cached.
+
+        if (imagesIdSet.contains(data->id))
+        {
+            const QVariantList values = imagesValues.value(data->id);
+
+            if (categoryIndex != -1 && !data->categoryCached)
+            {
+                if (!values.isEmpty())
+                {
+                    data->category = (DatabaseItem::Category)values.at(categoryIndex).toInt();
+                }
+
+                data->categoryCached = true;
+            }
+
+            if (modDateIndex != -1 && !data->modificationDateCached)
+            {
+                if (!values.isEmpty())
+                {
+                    data->modificationDate = values.at(modDateIndex).toDateTime();
+                }
+
+                data->modificationDateCached = true;
+            }
+
+            if (fileSizeIndex != -1 && !data->fileSizeCached)
+            {
+                if (!values.isEmpty())
+                {
+                    data->fileSize = values.at(fileSizeIndex).toLongLong();
+                }
+
+                data->fileSizeCached = true;
+            }
+
+            if (uniqueHashIndex != -1 && !data->uniqueHashCached)
+            {
+                if (!values.isEmpty())
+                {
+                    data->uniqueHash = values.at(uniqueHashIndex).toString();
+                }
+
+                data->uniqueHashCached = true;
+            }
+
+            if (manualOrderIndex != -1 && !data->manualOrderCached)
+            {
+                if (!values.isEmpty())
+                {
+                    data->manualOrder = values.at(manualOrderIndex).toLongLong();
+                }
+
+                data->manualOrderCached = true;
+            }
+        }
+
+        if (informationIdSet.contains(data->id))
+        {
+            const QVariantList values = informationValues.value(data->id);
+
+            if (ratingIndex != -1 && !data->ratingCached)
+            {
+                if (!values.isEmpty())
+                {
+                    data->rating = values.at(ratingIndex).toLongLong();
+                }
+
+                data->ratingCached = true;
+            }
+
+            if (creationDateIndex != -1 && !data->creationDateCached)
+            {
+                if (!values.isEmpty())
+                {
+                    data->creationDate = values.at(creationDateIndex).toDateTime();
+                }
+
+                data->creationDateCached = true;
+            }
+
+            if (formatIndex != -1 && !data->formatCached)
+            {
+                if (!values.isEmpty())
+                {
+                    data->format = values.at(formatIndex).toString();
+                }
+
+                data->formatCached = true;
+            }
+
+            if (widthIndex != -1 && heightIndex != -1 && !data->imageSizeCached)
+            {
+                if (!values.isEmpty())
+                {
+                    data->imageSize = QSize(values.at(widthIndex).toInt(), values.at(heightIndex).toInt());
+                }
+
+                data->imageSizeCached = true;
+            }
+        }
+    }
+}
+
 int ItemInfo::orientation() const
 {
     if (!m_data)
@@ -72,6 +72,14 @@ QList<QUrl> ItemInfoList::toImageUrlList() const
     return urlList;
 }
 
+ItemInfoList ItemInfoList::prefetch(const QList<qlonglong>& idList, const DatabaseFields::Set& fields)
+{
+    ItemInfoList infoList(idList);
+    infoList.loadDatabaseFields(fields);
+
+    return infoList;
+}
+
 bool ItemInfoList::namefileLessThan(const ItemInfo& d1, const ItemInfo& d2)
 {
     return d1.name().toLower() < d2.name().toLower(); // sort by name
@@ -32,6 +32,7 @@
 // Local includes
 
 #include "iteminfo.h"
+#include "coredbfields.h"
 #include "digikam_export.h"
 #include "digikam_config.h"
 
@@ -57,6 +58,23 @@ public:
     void loadGroupImageIds() const;
     void loadTagIds()        const;
 
+    /**
+     * Fill the ItemInfo cache of all items in this list with the given fields,
+     * using one database query per table and batch of ids instead of one query
+     * per item and field. Supported are the cached fields of the Images and
+     * ImageInformation tables (category, modification date, file size, unique hash,
+     * manual order, rating, creation date, format and dimensions).
+     * Requesting ColorLabel or PickLabel will load the tag ids.
+     * Items which have all requested fields already cached are skipped.
+     */
+    void loadDatabaseFields(const DatabaseFields::Set& fields) const;
+
+    /**
+     * Convenience method: create an ItemInfoList for the given ids,
+     * prefetch the given fields with loadDatabaseFields() and return it.
+     */
+    static ItemInfoList prefetch(const QList<qlonglong>& idList, const DatabaseFields::Set& fields);
+
     bool static namefileLessThan(const ItemInfo& d1, const ItemInfo& d2);
 
     /**
@@ -94,7 +94,12 @@ public:
      */
     int toInt32BitSafe(const QList<QVariant>::const_iterator& it)
     {
-        qlonglong v = (*it).toLongLong();
+        return toInt32BitSafe(*it);
+    }
+
+    int toInt32BitSafe(const QVariant& value)
+    {
+        qlonglong v = value.toLongLong();
 
         if (v > std::numeric_limits<int>::max() || v < 0)
         {
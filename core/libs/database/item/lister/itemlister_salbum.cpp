@@ -40,7 +40,6 @@ void ItemLister::listSearch(ItemListerReceiver* const receiver,
     }
 
     QList<QVariant> boundValues;
-    QList<QVariant> values;
     QString sqlQuery;
     QString errMsg;
 
@@ -78,73 +77,57 @@ void ItemLister::listSearch(ItemListerReceiver* const receiver,
 
     qCDebug(DIGIKAM_DATABASE_LOG) << "Search query:\n" << sqlQuery << "\n" << boundValues;
 
-    bool executionSuccess;
-    {
-        CoreDbAccess access;
-        executionSuccess = access.backend()->execSql(sqlQuery, boundValues, &values);
-
-        if (!executionSuccess)
-        {
-            errMsg = access.backend()->lastError();
-        }
-    }
-
-    if (!executionSuccess)
-    {
-        receiver->error(errMsg);
-        return;
-    }
-
-    qCDebug(DIGIKAM_DATABASE_LOG) << "Search result:" << values.size() / 14;
-
     QSet<int> albumRoots = albumRootsToList();
     int       width, height;
     double    lat, lon;
+    int       count = 0;
+
+    // The rows are read from a forward-only cursor and given to the receiver one by one,
+    // so a large result is not held in memory and the receiver can send the first parts at once.
 
     CoreDbAccess access;
+    DbEngineSqlQuery query = access.backend()->prepareQuery(sqlQuery);
+    query.setForwardOnly(true);
 
-    for (QList<QVariant>::const_iterator it = values.constBegin() ; it != values.constEnd() ;)
+    for (int i = 0 ; i < boundValues.size() ; ++i)
     {
-        ItemListerRecord record;
-
-        record.imageID           = (*it).toLongLong();
-        ++it;
-        record.name              = (*it).toString();
-        ++it;
-        record.albumID           = (*it).toInt();
-        ++it;
-        record.albumRootID       = (*it).toInt();
-        ++it;
-        record.rating            = (*it).toInt();
-        ++it;
-        record.category          = (DatabaseItem::Category)(*it).toInt();
-        ++it;
-        record.format            = (*it).toString();
-        ++it;
-        record.creationDate      = (*it).toDateTime();
-        ++it;
-        record.modificationDate  = (*it).toDateTime();
-        ++it;
-        record.fileSize          = d->toInt32BitSafe(it);
-        ++it;
-        width                    = (*it).toInt();
-        ++it;
-        height                   = (*it).toInt();
-        ++it;
-        lat                      = (*it).toDouble();
-        ++it;
-        lon                      = (*it).toDouble();
-        ++it;
+        query.bindValue(i, boundValues.at(i));
+    }
 
-        record.currentSimilarity = SimilarityDbAccess().db()->getImageSimilarity(record.imageID, referenceImageId);
+    if (!access.backend()->exec(query))
+    {
+        errMsg = access.backend()->lastError();
+        receiver->error(errMsg);
+        return;
+    }
 
-        if (record.currentSimilarity < 0)
+    while (query.next())
+    {
+        if (receiver->isCanceled())
         {
-            // Ignore nonexistence and invalid db entry.
-            record.currentSimilarity = 0.0;
+            qCDebug(DIGIKAM_DATABASE_LOG) << "Search canceled after" << count << "results";
+            query.finish();
+            return;
         }
 
-        record.currentFuzzySearchReferenceImage  = referenceImageId;
+        ++count;
+
+        ItemListerRecord record;
+
+        record.imageID           = query.value(0).toLongLong();
+        record.name              = query.value(1).toString();
+        record.albumID           = query.value(2).toInt();
+        record.albumRootID       = query.value(3).toInt();
+        record.rating            = query.value(4).toInt();
+        record.category          = (DatabaseItem::Category)query.value(5).toInt();
+        record.format            = query.value(6).toString();
+        record.creationDate      = query.value(7).toDateTime();
+        record.modificationDate  = query.value(8).toDateTime();
+        record.fileSize          = d->toInt32BitSafe(query.value(9));
+        width                    = query.value(10).toInt();
+        height                   = query.value(11).toInt();
+        lat                      = query.value(12).toDouble();
+        lon                      = query.value(13).toDouble();
 
         if (d->listOnlyAvailableImages && !albumRoots.contains(record.albumRootID))
         {
@@ -156,10 +139,24 @@ void ItemLister::listSearch(ItemListerReceiver* const receiver,
             continue;
         }
 
+        if (referenceImageId != -1)
+        {
+            record.currentSimilarity = SimilarityDbAccess().db()->getImageSimilarity(record.imageID, referenceImageId);
+
+            if (record.currentSimilarity < 0)
+            {
+                // Ignore nonexistence and invalid db entry.
+                record.currentSimilarity = 0.0;
+            }
+        }
+
+        record.currentFuzzySearchReferenceImage  = referenceImageId;
         record.imageSize         = QSize(width, height);
 
         receiver->receive(record);
     }
+
+    qCDebug(DIGIKAM_DATABASE_LOG) << "Search result:" << count;
 }
 
 void ItemLister::listHaarSearch(ItemListerReceiver* const receiver,
@@ -67,6 +67,11 @@ void ItemListerJobReceiver::error(const QString& errMsg)
     ItemListerValueListReceiver::error(errMsg);
 }
 
+bool ItemListerJobReceiver::isCanceled()
+{
+    return m_job->isCanceled();
+}
+
 // ----------------------------------------------
 
 ItemListerJobPartsSendingReceiver::ItemListerJobPartsSendingReceiver(DBJob* const job, int limit)
@@ -50,6 +50,10 @@ public:
     virtual ~ItemListerReceiver() {};
     virtual void receive(const ItemListerRecord& record) = 0;
     virtual void error(const QString& /*errMsg*/) {};
+
+    /** Return true to stop the listing before all records are received.
+     */
+    virtual bool isCanceled() { return false; };
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -79,6 +83,7 @@ public:
 
     explicit ItemListerJobReceiver(DBJob* const job);
     virtual void error(const QString& errMsg);
+    virtual bool isCanceled();
     void sendData();
 
 protected:
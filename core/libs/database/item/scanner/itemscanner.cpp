@@ -125,7 +125,26 @@ void ItemScanner::loadFromDisk()
 
     d->loadedFromDisk = true;
     d->metadata.registerMetadataSettings();
-    d->hasMetadata    = d->metadata.load(d->fileInfo.filePath());
+
+    MetaEngineSettingsContainer settings = MetaEngineSettings::instance()->settings();
+    bool useSidecar                      = settings.useXMPSidecar4Reading && DMetadata::hasSidecar(d->fileInfo.filePath());
+
+    // Data captured when the file was written, for instance by the camera import, saves reading it again.
+    ItemScanPrefetch prefetch            = ItemScanPrefetch::take(d->fileInfo.filePath());
+
+    if (!prefetch.isValidFor(d->fileInfo))
+    {
+        prefetch = ItemScanPrefetch();
+    }
+
+    if (!prefetch.metadataData.isEmpty() && !useSidecar)
+    {
+        d->hasMetadata = d->metadata.loadFromData(prefetch.metadataData);
+    }
+    else
+    {
+        d->hasMetadata = d->metadata.load(d->fileInfo.filePath());
+    }
 
     if (d->scanInfo.category == DatabaseItem::Image)
     {
@@ -136,6 +155,31 @@ void ItemScanner::loadFromDisk()
         d->hasImage = false;
     }
 
+    d->scanInfo.itemName         = d->fileInfo.fileName();
+    d->scanInfo.fileSize         = d->fileInfo.size();
+    d->scanInfo.modificationDate = fileModificationDate();
+    // category is set by setCategory
+    // NOTE: call uniqueHash after loading the image above, else it will fail
+
+    if (!prefetch.isNull() && CoreDbAccess().db()->isUniqueHashV2())
+    {
+        d->scanInfo.uniqueHash   = prefetch.uniqueHash;
+        d->img.setAttribute(QLatin1String("uniqueHashV2"), prefetch.uniqueHash.toUtf8());
+    }
+    else
+    {
+        d->scanInfo.uniqueHash   = uniqueHash();
+    }
+
+   // faster than loading twice from disk
+    if (d->hasMetadata)
+    {
+        d->img.setMetadata(d->metadata.data());
+    }
+}
+
+QDateTime ItemScanner::fileModificationDate() const
+{
     MetaEngineSettingsContainer settings = MetaEngineSettings::instance()->settings();
     QDateTime modificationDate           = d->fileInfo.lastModified();
 
@@ -150,18 +194,7 @@ void ItemScanner::loadFromDisk()
         }
     }
 
-    d->scanInfo.itemName         = d->fileInfo.fileName();
-    d->scanInfo.fileSize         = d->fileInfo.size();
-    d->scanInfo.modificationDate = modificationDate;
-    // category is set by setCategory
-    // NOTE: call uniqueHash after loading the image above, else it will fail
-    d->scanInfo.uniqueHash       = uniqueHash();
-
-   // faster than loading twice from disk
-    if (d->hasMetadata)
-    {
-        d->img.setMetadata(d->metadata.data());
-    }
+    return modificationDate;
 }
 
 QString ItemScanner::formatToString(const QString& format)
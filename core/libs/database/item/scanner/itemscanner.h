@@ -96,6 +96,12 @@ public:
      */
     void loadFromDisk();
 
+    /**
+     * Returns the modification date of the file as stored in the database,
+     * i.e. the date of the sidecar if it is newer and used for reading.
+     */
+    QDateTime fileModificationDate() const;
+
     /**
      * Helper method to translate enum values to user presentable strings
      */
@@ -156,6 +162,8 @@ public:
      * which is a copy of another file, copying attributes from the src
      * and rescanning other attributes as appropriate.
      * Give the id of the album of the new file, and the id of the src file.
+     * If the file is an unchanged copy of the src, the database entries
+     * of the src are cloned without reading the file metadata.
      */
     void copiedFrom(int albumId, qlonglong srcId);
 
@@ -169,6 +177,7 @@ public:
 protected:
 
     bool copyFromSource(qlonglong src);
+    bool cloneFromSource(qlonglong src);
     void commitCopyImageAttributes();
 
     void prepareAddImage(int albumId);
@@ -104,6 +104,13 @@ void ItemScanner::commit()
 
 void ItemScanner::newFile(int albumId)
 {
+    // An unchanged copy of a known file only needs the database entries to be cloned.
+    if (cloneFromSource(0))
+    {
+        prepareAddImage(albumId);
+        return;
+    }
+
     loadFromDisk();
     prepareAddImage(albumId);
 
@@ -129,6 +136,12 @@ void ItemScanner::rescan()
 
 void ItemScanner::copiedFrom(int albumId, qlonglong srcId)
 {
+    if (cloneFromSource(srcId))
+    {
+        prepareAddImage(albumId);
+        return;
+    }
+
     loadFromDisk();
     prepareAddImage(albumId);
 
@@ -152,6 +165,18 @@ void ItemScanner::commitCopyImageAttributes()
     // Remove grouping for copied or identical images.
     CoreDbAccess().db()->removeAllImageRelationsFrom(d->scanInfo.id, DatabaseRelation::Grouped);
     CoreDbAccess().db()->removeAllImageRelationsTo(d->scanInfo.id, DatabaseRelation::Grouped);
+
+    // The thumbnail is found by the unique hash, also reference it by the path of the copy.
+    if (ThumbsDbAccess::isInitialized())
+    {
+        ThumbsDbAccess access;
+        ThumbsDbInfo thumbInfo = access.db()->findByHash(d->scanInfo.uniqueHash, d->scanInfo.fileSize);
+
+        if (thumbInfo.id != -1)
+        {
+            access.db()->insertFilePath(d->fileInfo.filePath(), thumbInfo.id);
+        }
+    }
 }
 
 bool ItemScanner::copyFromSource(qlonglong srcId)
@@ -177,6 +202,66 @@ bool ItemScanner::copyFromSource(qlonglong srcId)
     return true;
 }
 
+bool ItemScanner::cloneFromSource(qlonglong srcId)
+{
+    // Only the unique hash version 2 can be computed without parsing the file.
+    if (d->loadedFromDisk || !CoreDbAccess().db()->isUniqueHashV2())
+    {
+        return false;
+    }
+
+    ItemScanPrefetch prefetch = ItemScanPrefetch::take(d->fileInfo.filePath());
+
+    if (!prefetch.isValidFor(d->fileInfo))
+    {
+        prefetch                  = ItemScanPrefetch();
+        prefetch.fileSize         = d->fileInfo.size();
+        prefetch.modificationDate = d->fileInfo.lastModified();
+        prefetch.uniqueHash       = QString::fromUtf8(DImg::getUniqueHashV2(d->fileInfo.filePath()));
+    }
+
+    QDateTime modificationDate = fileModificationDate();
+    QList<ItemScanInfo> candidates;
+
+    if (srcId)
+    {
+        candidates << CoreDbAccess().db()->getItemScanInfo(srcId);
+    }
+    else
+    {
+        candidates = CoreDbAccess().db()->getIdenticalFiles(prefetch.uniqueHash, prefetch.fileSize, d->scanInfo.id);
+        std::stable_sort(candidates.begin(), candidates.end(), lessThanForIdentity);
+    }
+
+    foreach (const ItemScanInfo& info, candidates)
+    {
+        // Same content, and same modification date: the metadata of the file did not change either.
+        if (info.id                                   &&
+            (info.id         != d->scanInfo.id)       &&
+            (info.category   == d->scanInfo.category) &&
+            (info.fileSize   == prefetch.fileSize)    &&
+            (info.uniqueHash == prefetch.uniqueHash)  &&
+            (qAbs(info.modificationDate.secsTo(modificationDate)) <= 1))
+        {
+            qCDebug(DIGIKAM_DATABASE_LOG) << "Recognized" << d->fileInfo.filePath()
+                                          << "as unchanged copy of" << info.id;
+
+            d->scanInfo.itemName            = d->fileInfo.fileName();
+            d->scanInfo.fileSize            = prefetch.fileSize;
+            d->scanInfo.modificationDate    = modificationDate;
+            d->scanInfo.uniqueHash          = prefetch.uniqueHash;
+            d->commit.copyImageAttributesId = info.id;
+
+            return true;
+        }
+    }
+
+    // Spare computing the unique hash again when the file is scanned.
+    ItemScanPrefetch::record(d->fileInfo.filePath(), prefetch);
+
+    return false;
+}
+
 void ItemScanner::prepareAddImage(int albumId)
 {
     d->scanInfo.albumID          = albumId;
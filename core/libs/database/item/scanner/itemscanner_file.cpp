@@ -288,6 +288,8 @@ bool ItemScanner::scanFromIdenticalFile()
 
 void ItemScanner::fileModified()
 {
+    // Do not use metadata parsed before the change.
+    MetaEngineCache::instance()->remove(d->fileInfo.filePath());
     loadFromDisk();
     prepareUpdateImage();
     scanFile(ModifiedScan);
@@ -52,11 +52,15 @@
 #include "itemextendedproperties.h"
 #include "itemhistorygraph.h"
 #include "metaenginesettings.h"
+#include "metaenginecache.h"
 #include "tagregion.h"
 #include "tagscache.h"
 #include "iostream"
 #include "dimagehistory.h"
 #include "itemhistorygraphdata.h"
+#include "itemscanprefetch.h"
+#include "thumbsdbaccess.h"
+#include "thumbsdb.h"
 
 namespace Digikam
 {
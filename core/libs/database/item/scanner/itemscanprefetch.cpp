@@ -0,0 +1,151 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : Scan data captured before an item is scanned.
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "itemscanprefetch.h"
+
+// Qt includes
+
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+
+// Local includes
+
+#include "digikam_debug.h"
+
+namespace Digikam
+{
+
+class Q_DECL_HIDDEN ItemScanPrefetchStore
+{
+public:
+
+    explicit ItemScanPrefetchStore()
+        : metadataBytes(0)
+    {
+    }
+
+    void remove(const QString& filePath)
+    {
+        QHash<QString, ItemScanPrefetch>::iterator it = entries.find(filePath);
+
+        if (it != entries.end())
+        {
+            metadataBytes -= it.value().metadataData.size();
+            entries.erase(it);
+        }
+    }
+
+public:
+
+    /// Entries not taken, for instance if a download is not scanned, must not pile up.
+    static const int    maxEntries       = 4096;
+    static const qint64 maxMetadataBytes = 64 * 1024 * 1024;
+
+    QMutex                           mutex;
+    QHash<QString, ItemScanPrefetch> entries;
+    qint64                           metadataBytes;
+};
+
+Q_GLOBAL_STATIC(ItemScanPrefetchStore, prefetchStore)
+
+// -------------------------------------------------------------------------------
+
+ItemScanPrefetch::ItemScanPrefetch()
+    : fileSize(-1)
+{
+}
+
+ItemScanPrefetch::~ItemScanPrefetch()
+{
+}
+
+bool ItemScanPrefetch::isNull() const
+{
+    return uniqueHash.isEmpty();
+}
+
+bool ItemScanPrefetch::isValidFor(const QFileInfo& info) const
+{
+    if (isNull() || (fileSize != info.size()))
+    {
+        return false;
+    }
+
+    // Allow the same "modify window" of one second as the collection scanner,
+    // FAT filesystems store the modify date in 2-second resolution.
+    return (qAbs(modificationDate.secsTo(info.lastModified())) <= 1);
+}
+
+void ItemScanPrefetch::record(const QString& filePath, const ItemScanPrefetch& prefetch)
+{
+    ItemScanPrefetchStore* const store = prefetchStore;
+    QMutexLocker lock(&store->mutex);
+
+    store->remove(filePath);
+
+    if (prefetch.isNull())
+    {
+        return;
+    }
+
+    if (store->entries.size() >= ItemScanPrefetchStore::maxEntries)
+    {
+        qCDebug(DIGIKAM_DATABASE_LOG) << "Dropping" << store->entries.size() << "scan prefetch entries not used";
+        store->entries.clear();
+        store->metadataBytes = 0;
+    }
+
+    ItemScanPrefetch entry = prefetch;
+
+    // The unique hash is kept in all cases, the scan reads the metadata from disk if they are dropped.
+
+    if ((store->metadataBytes + entry.metadataData.size()) > ItemScanPrefetchStore::maxMetadataBytes)
+    {
+        entry.metadataData.clear();
+    }
+
+    store->metadataBytes += entry.metadataData.size();
+    store->entries.insert(filePath, entry);
+}
+
+ItemScanPrefetch ItemScanPrefetch::take(const QString& filePath)
+{
+    ItemScanPrefetchStore* const store = prefetchStore;
+    QMutexLocker lock(&store->mutex);
+
+    ItemScanPrefetch entry = store->entries.value(filePath);
+    store->remove(filePath);
+
+    return entry;
+}
+
+void ItemScanPrefetch::remove(const QString& filePath)
+{
+    ItemScanPrefetchStore* const store = prefetchStore;
+    QMutexLocker lock(&store->mutex);
+
+    store->remove(filePath);
+}
+
+} // namespace Digikam
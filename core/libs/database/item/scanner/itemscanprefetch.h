@@ -0,0 +1,88 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : Scan data captured before an item is scanned.
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_ITEM_SCAN_PREFETCH_H
+#define DIGIKAM_ITEM_SCAN_PREFETCH_H
+
+// Qt includes
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QFileInfo>
+#include <QImage>
+#include <QString>
+
+// Local includes
+
+#include "digikam_export.h"
+
+namespace Digikam
+{
+
+/**
+ * Data of a file captured while the file is written, for instance when it is
+ * downloaded from a camera. The ItemScanner uses it instead of reading the file
+ * again, if the file has not changed since the data was recorded.
+ */
+class DIGIKAM_DATABASE_EXPORT ItemScanPrefetch
+{
+public:
+
+    ItemScanPrefetch();
+    ~ItemScanPrefetch();
+
+    bool isNull() const;
+
+    /** Return true if the data was captured from the file as it is now on disk,
+     *  comparing size and modification date.
+     */
+    bool isValidFor(const QFileInfo& info) const;
+
+public:
+
+    /** The recorded data, by file path. All these methods are thread-safe.
+     *  An entry is removed when it is taken, the store keeps a limited amount of
+     *  entries and of metadata bytes.
+     */
+    static void             record(const QString& filePath, const ItemScanPrefetch& prefetch);
+    static ItemScanPrefetch take(const QString& filePath);
+    static void             remove(const QString& filePath);
+
+public:
+
+    qlonglong  fileSize;
+    QDateTime  modificationDate;
+
+    /// The unique hash of the file, version 2. See DImg::getUniqueHashV2().
+    QString    uniqueHash;
+
+    /// The beginning of the file, holding all the metadata. Empty if unknown.
+    QByteArray metadataData;
+
+    /// The largest embedded preview, only kept until the thumbnail is stored.
+    QImage     preview;
+};
+
+} // namespace Digikam
+
+#endif // DIGIKAM_ITEM_SCAN_PREFETCH_H
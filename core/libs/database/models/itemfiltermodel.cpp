@@ -430,6 +430,8 @@ void ItemFilterModel::setItemFilterSettings(const ItemFilterSettings& settings)
         d->needPrepareTags     = settings.isFilteringByTags();
         d->needPrepareGroups   = true;
         d->needPrepare         = d->needPrepareComments || d->needPrepareTags || d->needPrepareGroups;
+        d->prepareFields       = settings.watchFlags();
+        d->prepareFields.setFields(d->sorter.watchFlags());
 
         d->hasOneMatch         = false;
         d->hasOneMatchForText  = false;
@@ -649,6 +651,7 @@ void ItemFilterModelPreparer::process(ItemFilterModelTodoPackage package)
 
     // get thread-local copy
     bool needPrepareTags, needPrepareComments, needPrepareGroups;
+    DatabaseFields::Set prepareFields;
     QList<ItemFilterModelPrepareHook*> prepareHooks;
 
     {
@@ -656,6 +659,7 @@ void ItemFilterModelPreparer::process(ItemFilterModelTodoPackage package)
         needPrepareTags     = d->needPrepareTags;
         needPrepareComments = d->needPrepareComments;
         needPrepareGroups   = d->needPrepareGroups;
+        prepareFields       = d->prepareFields;
         prepareHooks        = d->prepareHooks;
     }
 
@@ -678,8 +682,9 @@ void ItemFilterModelPreparer::process(ItemFilterModelTodoPackage package)
     // Nonetheless, QList and ItemInfo is fast. We could as well
     // reimplement ItemInfoList to ItemInfoVector (internally with templates?)
     ItemInfoList infoList;
+    bool needPrepareFields = prepareFields.hasFieldsFromImages() || prepareFields.hasFieldsFromItemInformation();
 
-    if (needPrepareTags || needPrepareGroups)
+    if (needPrepareTags || needPrepareGroups || needPrepareFields)
     {
         infoList = ItemInfoList(package.infos.toList());
     }
@@ -689,6 +694,13 @@ void ItemFilterModelPreparer::process(ItemFilterModelTodoPackage package)
         infoList.loadTagIds();
     }
 
+    // Warm the ItemInfo cache for the fields used by filtering and sorting,
+    // with one query per table instead of one query per item and field.
+    if (needPrepareFields)
+    {
+        infoList.loadDatabaseFields(prepareFields);
+    }
+
     if (needPrepareGroups)
     {
         infoList.loadGroupImageIds();
@@ -791,6 +803,13 @@ void ItemFilterModel::setItemSortSettings(const ItemSortSettings& sorter)
 {
     Q_D(ItemFilterModel);
     d->sorter = sorter;
+
+    {
+        QMutexLocker lock(&d->mutex);
+        d->prepareFields = d->filter.watchFlags();
+        d->prepareFields.setFields(d->sorter.watchFlags());
+    }
+
     setCategorizedModel(d->sorter.categorizationMode != ItemSortSettings::NoCategories);
     invalidate();
 }
@@ -117,6 +117,7 @@ public:
     bool                                needPrepareComments;
     bool                                needPrepareTags;
     bool                                needPrepareGroups;
+    DatabaseFields::Set                 prepareFields;
 
     QMutex                              mutex;
     ItemFilterSettings                 filterCopy;
@@ -215,6 +215,23 @@ QList<int> ThumbsDb::findAll()
     return thumbIds;
 }
 
+QList<int> ThumbsDb::findByCustomIdentifierPrefix(const QString& prefix)
+{
+    QList<QVariant> values;
+    d->db->execSql(QLatin1String("SELECT thumbId FROM CustomIdentifiers WHERE identifier LIKE ?;"),
+                   QString(prefix + QLatin1Char('%')),
+                   &values);
+
+    QList<int> thumbIds;
+
+    foreach (const QVariant& object, values)
+    {
+        thumbIds << object.toInt();
+    }
+
+    return thumbIds;
+}
+
 QHash<QString, int> ThumbsDb::getFilePathsWithThumbnail()
 {
     DbEngineSqlQuery query = d->db->prepareQuery(QString::fromLatin1("SELECT path, thumbId "
@@ -239,6 +256,28 @@ QHash<QString, int> ThumbsDb::getFilePathsWithThumbnail()
     return filePaths;
 }
 
+qlonglong ThumbsDb::findVideoFramePosition(const QString& path, const QDateTime& modificationDate)
+{
+    QList<QVariant> values;
+    d->db->execSql(QLatin1String("SELECT modificationDate, position FROM VideoFrames WHERE path=?;"),
+                   path, &values);
+
+    // The database may not keep the milliseconds.
+    if (values.size() != 2 || values.at(0).toDateTime().secsTo(modificationDate) != 0)
+    {
+        return -1;
+    }
+
+    return values.at(1).toLongLong();
+}
+
+BdEngineBackend::QueryState ThumbsDb::insertVideoFramePosition(const QString& path, const QDateTime& modificationDate,
+                                                               qlonglong position)
+{
+    return d->db->execSql(QLatin1String("REPLACE INTO VideoFrames (path, modificationDate, position) VALUES (?,?,?);"),
+                          path, modificationDate, position);
+}
+
 BdEngineBackend::QueryState ThumbsDb::insertUniqueHash(const QString& uniqueHash, qlonglong fileSize, int thumbId)
 {
     return d->db->execSql(QLatin1String("REPLACE INTO UniqueHashes (uniqueHash, fileSize, thumbId) VALUES (?,?,?);"),
@@ -314,6 +353,9 @@ BdEngineBackend::QueryState ThumbsDb::insertThumbnail(const ThumbsDbInfo& info,
 
 BdEngineBackend::QueryState ThumbsDb::renameByFilePath(const QString& oldPath, const QString& newPath)
 {
+    d->db->execSql(QLatin1String("UPDATE VideoFrames SET path=? WHERE path=?;"),
+                   newPath, oldPath);
+
     return d->db->execSql(QLatin1String("UPDATE FilePaths SET path=? WHERE path=?;"),
                           newPath, oldPath);
 }
@@ -103,6 +103,10 @@ public:
      */
     QList<int> findAll();
 
+    /** Returns the thumbnail ids of all custom identifiers starting with the given prefix.
+     */
+    QList<int> findByCustomIdentifierPrefix(const QString& prefix);
+
     BdEngineBackend::QueryState insertUniqueHash(const QString& uniqueHash, qlonglong fileSize, int thumbId);
     BdEngineBackend::QueryState insertFilePath(const QString& path, int thumbId);
     BdEngineBackend::QueryState insertCustomIdentifier(const QString& id, int thumbId);
@@ -121,6 +125,13 @@ public:
 
     QHash<QString, int> getFilePathsWithThumbnail();
 
+    /** Returns the position in milliseconds of the frame selected for the thumbnail
+     *  of the video file, or -1 if there is none or if the file was modified since.
+     */
+    qlonglong findVideoFramePosition(const QString& path, const QDateTime& modificationDate);
+    BdEngineBackend::QueryState insertVideoFramePosition(const QString& path, const QDateTime& modificationDate,
+                                                         qlonglong position);
+
     void replaceUniqueHash(const QString& oldUniqueHash, int oldFileSize, const QString& newUniqueHash, int newFileSize);
     BdEngineBackend::QueryState updateModificationDate(int thumbId, const QDateTime& modificationDate);
 
@@ -2946,6 +2946,11 @@ QByteArray DImg::getUniqueHashV2(const QString& filePath)
     return DImgLoader::uniqueHashV2(filePath);
 }
 
+QByteArray DImg::getUniqueHashV2(const QByteArray& firstBytes, const QByteArray& lastBytes)
+{
+    return DImgLoader::uniqueHashV2(firstBytes, lastBytes);
+}
+
 QByteArray DImg::createImageUniqueId() const
 {
     NonDeterministicRandomData randomData(16);
@@ -636,6 +636,12 @@ public:
     QByteArray getUniqueHashV2() const;
     static QByteArray getUniqueHashV2(const QString& filePath);
 
+    /** Return the same hash as getUniqueHashV2(), from data already read from the file:
+     *  the first and the last 100 kB of the file, or the whole file twice if it is smaller.
+     *  Use this to hash a file while it is copied, without reading it again.
+     */
+    static QByteArray getUniqueHashV2(const QByteArray& firstBytes, const QByteArray& lastBytes);
+
     /** This method creates a new 256-bit UUID meant to be globally unique.
      *  The UUID will be returned as a 64-byte hexadecimal string.
      *  At least 128bits of the UUID will be created by the platform random number
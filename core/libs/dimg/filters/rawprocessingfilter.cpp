@@ -24,6 +24,10 @@
 
 #include "rawprocessingfilter.h"
 
+// Qt includes
+
+#include <QtConcurrent>    // krazy:exclude=includes
+
 // DRawDecoder includes
 
 #include "drawdecoder.h"
@@ -142,26 +146,65 @@ void RawProcessingFilter::filterImage()
 
     postProgress(20);
 
-    if (!m_settings.wb.isDefault())
+    WBContainer wb = m_settings.wb;
+
+    // The white balance multipliers are scaled with the channels maximum of the whole image.
+    // Compute them once here, all post-processing steps are per-pixel after that, and the
+    // image can be processed by independent bands.
+
+    if (!wb.isDefault() && (wb.maxr == -1) && (wb.maxg == -1) && (wb.maxb == -1))
     {
-        WBFilter wb(m_settings.wb, this, m_orgImage, m_destImage, 20, 40);
+        WBFilter::findChanelsMax(&m_orgImage, wb.maxr, wb.maxg, wb.maxb);
     }
 
     postProgress(40);
 
-    if (!m_settings.bcg.isDefault())
+    QList<int> vals = multithreadedSteps(m_orgImage.height());
+    QList <QFuture<void> > tasks;
+
+    for (int j = 0 ; continueQuery() && (j < vals.count()-1) ; ++j)
     {
-        BCGFilter bcg(m_settings.bcg, this, m_orgImage, m_destImage, 40, 70);
+        tasks.append(QtConcurrent::run(this,
+                                       &RawProcessingFilter::postProcessBand,
+                                       wb,
+                                       vals[j],
+                                       vals[j+1]
+                                      ));
     }
 
-    postProgress(70);
+    foreach(QFuture<void> t, tasks)
+        t.waitForFinished();
+
+    postProgress(100);
+}
+
+void RawProcessingFilter::postProcessBand(const WBContainer& wb, int start, int stop)
+{
+    if (start >= stop)
+    {
+        return;
+    }
+
+    DImg band = m_orgImage.copy(0, start, m_orgImage.width(), stop - start);
+
+    // The filters run without master, progress is only posted by filterImage().
+
+    if (!wb.isDefault())
+    {
+        WBFilter wbFilter(wb, 0, band, band);
+    }
+
+    if (!m_settings.bcg.isDefault())
+    {
+        BCGFilter bcg(m_settings.bcg, 0, band, band);
+    }
 
     if (!m_settings.curvesAdjust.isEmpty())
     {
-        CurvesFilter curves(m_settings.curvesAdjust, this, m_orgImage, m_destImage, 70, 100);
+        CurvesFilter curves(m_settings.curvesAdjust, 0, band, band);
     }
 
-    postProgress(100);
+    m_orgImage.bitBltImage(&band, 0, start);
 }
 
 } // namespace Digikam
@@ -135,6 +135,12 @@ protected:
 
     virtual void filterImage();
 
+    /**
+     * Apply the white balance, the BCG and the curves post-processing to the rows
+     * [start, stop[ of the image. Called in parallel for independent bands.
+     */
+    void postProcessBand(const WBContainer& wb, int start, int stop);
+
 protected:
 
     DRawDecoding        m_settings;
@@ -367,6 +367,17 @@ QByteArray DImgLoader::uniqueHashV2(const QString& filePath, const DImg* const i
     return hash;
 }
 
+QByteArray DImgLoader::uniqueHashV2(const QByteArray& firstBytes, const QByteArray& lastBytes)
+{
+    // Must match the file based version above.
+    QCryptographicHash md5(QCryptographicHash::Md5);
+
+    md5.addData(firstBytes);
+    md5.addData(lastBytes);
+
+    return md5.result().toHex();
+}
+
 QByteArray DImgLoader::uniqueHash(const QString& filePath, const DImg& img, bool loadMetadata)
 {
     QByteArray bv;
@@ -31,6 +31,8 @@
 // Qt includes
 
 #include <QByteArray>
+#include <QThreadPool>
+#include <QtConcurrent>    // krazy:exclude=includes
 
 // Local includes
 
@@ -151,115 +153,77 @@ void RAWLoader::setWaitingDataProgress(double value)
 bool RAWLoader::loadedFromRawData(const QByteArray& data, int width, int height, int rgbmax,
                                   DImgLoaderObserver* const observer)
 {
-    int checkpoint = 0;
+    // 16 bits image use 8 bytes by pixel, 8 bits image 4 bytes.
+    uchar* image = new_failureTolerant(width, height, m_decoderSettings.sixteenBitsImage ? 8 : 4);
 
-    if (m_decoderSettings.sixteenBitsImage)       // 16 bits image
+    if (!image)
     {
-        uchar* image = new_failureTolerant(width, height, 8);
-
-        if (!image)
-        {
-            qCWarning(DIGIKAM_DIMG_LOG_RAW) << "Failed to allocate memory for loading raw file";
-            return false;
-        }
-
-        unsigned short* dst = reinterpret_cast<unsigned short*>(image);
-        uchar*          src = (uchar*)data.data();
-        float fac           = 65535.0 / rgbmax;
-        checkpoint          = 0;
-
-        for (int h = 0; h < height; ++h)
-        {
-            if (observer && h == checkpoint)
-            {
-                checkpoint += granularity(observer, height, 1.0);
-
-                if (!observer->continueQuery(m_image))
-                {
-                    delete [] image;
-                    return false;
-                }
-
-                observer->progressInfo(m_image, 0.7 + 0.2 * (((float)h) / ((float)height)));
-            }
-
-            for (int w = 0; w < width; ++w)
-            {
-                if (QSysInfo::ByteOrder == QSysInfo::LittleEndian)     // Intel
-                {
-                    dst[0] = (unsigned short)((src[5] * 256 + src[4]) * fac);    // Blue
-                    dst[1] = (unsigned short)((src[3] * 256 + src[2]) * fac);    // Green
-                    dst[2] = (unsigned short)((src[1] * 256 + src[0]) * fac);    // Red
-                }
-                else
-                {
-                    dst[0] = (unsigned short)((src[4] * 256 + src[5]) * fac);    // Blue
-                    dst[1] = (unsigned short)((src[2] * 256 + src[3]) * fac);    // Green
-                    dst[2] = (unsigned short)((src[0] * 256 + src[1]) * fac);    // Red
-                }
+        qCWarning(DIGIKAM_DIMG_LOG_RAW) << "Failed to allocate memory for loading raw file";
+        return false;
+    }
 
-                dst[3]  = 0xFFFF;
+    // No need to adapt RGB components accordingly with rgbmax value in 8 bits because Raw engine
+    // always return rgbmax to 255 in 8 bits/color/pixels.
+    float fac = 65535.0 / rgbmax;
 
-                dst    += 4;
-                src    += 6;
-            }
-        }
+    // The rows are converted by independent bands in parallel. Cancellation and progress
+    // are handled here, while waiting for the bands in the order they were started.
 
-        // ----------------------------------------------------------
+    const int nbBands     = qMax(QThreadPool::globalInstance()->maxThreadCount() * 2, 1);
+    const int rowsPerBand = qMax((height + nbBands - 1) / nbBands, 1);
+    const uchar* src      = (const uchar*)data.constData();
+    QList<QFuture<void> > tasks;
 
-        imageData() = (uchar*)image;
-    }
-    else        // 8 bits image
+    for (int row = 0 ; row < height ; row += rowsPerBand)
     {
-        uchar* image = new_failureTolerant(width, height, 4);
+        const int rows = qMin(rowsPerBand, height - row);
 
-        if (!image)
+        if (m_decoderSettings.sixteenBitsImage)
         {
-            qCWarning(DIGIKAM_DIMG_LOG_RAW) << "Failed to allocate memory for loading raw file";
-            return false;
+            tasks.append(QtConcurrent::run(&RAWLoader::convertRows16,
+                                           src + (qint64)row * width * 6,
+                                           reinterpret_cast<unsigned short*>(image + (qint64)row * width * 8),
+                                           width, rows, fac));
         }
-
-        uchar* dst = image;
-        uchar* src = (uchar*)data.data();
-        checkpoint = 0;
-
-        for (int h = 0; h < height; ++h)
+        else
         {
+            tasks.append(QtConcurrent::run(&RAWLoader::convertRows8,
+                                           src + (qint64)row * width * 3,
+                                           image + (qint64)row * width * 4,
+                                           width, rows));
+        }
+    }
 
-            if (observer && h == checkpoint)
-            {
-                checkpoint += granularity(observer, height, 1.0);
-
-                if (!observer->continueQuery(m_image))
-                {
-                    delete [] image;
-                    return false;
-                }
+    bool cancelled = false;
 
-                observer->progressInfo(m_image, 0.7 + 0.2 * (((float)h) / ((float)height)));
-            }
+    for (int i = 0 ; i < tasks.count() ; ++i)
+    {
+        tasks[i].waitForFinished();
 
-            for (int w = 0; w < width; ++w)
+        if (observer && !cancelled)
+        {
+            if (!observer->continueQuery(m_image))
             {
-                // No need to adapt RGB components accordingly with rgbmax value because Raw engine
-                // always return rgbmax to 255 in 8 bits/color/pixels.
-
-                dst[0]  = src[2];    // Blue
-                dst[1]  = src[1];    // Green
-                dst[2]  = src[0];    // Red
-                dst[3]  = 0xFF;      // Alpha
-
-                dst    += 4;
-                src    += 3;
+                // Running bands cannot be stopped, wait for them before to release the image.
+                cancelled = true;
+                continue;
             }
-        }
 
-        // NOTE: if Color Management is not used here, output color space is in sRGB* color space.
-        // Gamma and White balance are previously adjusted by Raw engine in 8 bits color depth.
+            observer->progressInfo(m_image, 0.7 + 0.2 * (((float)(i + 1)) / ((float)tasks.count())));
+        }
+    }
 
-        imageData() = image;
+    if (cancelled)
+    {
+        delete [] image;
+        return false;
     }
 
+    // NOTE: in 8 bits, if Color Management is not used here, output color space is in sRGB* color space.
+    // Gamma and White balance are previously adjusted by Raw engine in 8 bits color depth.
+
+    imageData() = image;
+
     //----------------------------------------------------------
     // Assign the right color-space profile.
 
@@ -317,6 +281,40 @@ bool RAWLoader::loadedFromRawData(const QByteArray& data, int width, int height,
     return true;
 }
 
+void RAWLoader::convertRows16(const uchar* src, unsigned short* dst, int width, int rows, float fac)
+{
+    // Raw engine returns 16 bits RGB components in host byte order.
+    const unsigned short* rgb = reinterpret_cast<const unsigned short*>(src);
+    const qint64 pixels       = (qint64)width * rows;
+
+    for (qint64 i = 0 ; i < pixels ; ++i)
+    {
+        dst[0] = (unsigned short)(rgb[2] * fac);    // Blue
+        dst[1] = (unsigned short)(rgb[1] * fac);    // Green
+        dst[2] = (unsigned short)(rgb[0] * fac);    // Red
+        dst[3] = 0xFFFF;                            // Alpha
+
+        dst   += 4;
+        rgb   += 3;
+    }
+}
+
+void RAWLoader::convertRows8(const uchar* src, uchar* dst, int width, int rows)
+{
+    const qint64 pixels = (qint64)width * rows;
+
+    for (qint64 i = 0 ; i < pixels ; ++i)
+    {
+        dst[0] = src[2];    // Blue
+        dst[1] = src[1];    // Green
+        dst[2] = src[0];    // Red
+        dst[3] = 0xFF;      // Alpha
+
+        dst   += 4;
+        src   += 3;
+    }
+}
+
 void RAWLoader::postProcess(DImgLoaderObserver* const observer)
 {
     if (m_filter->settings().postProcessingSettingsIsDirty())
@@ -64,6 +64,12 @@ private:
     bool loadedFromRawData(const QByteArray& data, int width, int height, int rgbmax,
                            DImgLoaderObserver* const observer);
 
+    /**
+     * Convert rows of Raw engine RGB data to DImg BGRA pixels, with fac applied in 16 bits.
+     */
+    static void convertRows16(const uchar* src, unsigned short* dst, int width, int rows, float fac);
+    static void convertRows8(const uchar* src, uchar* dst, int width, int rows);
+
     bool checkToCancelWaitingData();
     void setWaitingDataProgress(double value);
 
@@ -60,7 +60,9 @@ extern "C"
 #include <QFile>
 #include <QFileInfo>
 #include <QIODevice>
-#include <QTemporaryFile>
+#include <QBuffer>
+#include <QList>
+#include <QtConcurrent>
 #include <qplatformdefs.h>
 
 // Local includes
@@ -1061,42 +1063,47 @@ int DNGWriter::convert()
                 return PROCESSFAILED;
             }
 
-            QDataStream originalDataStream(&originalFile);
+            // The original file is compressed in memory by blocks of CHUNK bytes, which are
+            // independent and processed in parallel. The blocks are stored in file order.
 
-            quint32 forkLength = originalFileInfo.size();
-            quint32 forkBlocks = (quint32)floor((forkLength + 65535.0) / 65536.0);
-
-            QVector<quint32> offsets;
-            quint32 offset = (2 + forkBlocks) * sizeof(quint32);
-            offsets.push_back(offset);
-
-            QByteArray originalDataBlock;
-            originalDataBlock.resize(CHUNK);
-
-            QTemporaryFile compressedFile;
+            QByteArray originalData = originalFile.readAll();
+            originalFile.close();
 
-            if (!compressedFile.open())
+            if (originalData.size() != originalFileInfo.size())
             {
-                qCDebug(DIGIKAM_GENERAL_LOG) << "DNGWriter: Cannot open temporary file to write Zipped Raw data. Aborted...";
+                qCDebug(DIGIKAM_GENERAL_LOG) << "DNGWriter: Cannot read original RAW file to backup in DNG. Aborted...";
                 return PROCESSFAILED;
             }
 
-            QDataStream compressedDataStream(&compressedFile);
+            quint32 forkLength = originalData.size();
+            quint32 forkBlocks = (quint32)floor((forkLength + 65535.0) / 65536.0);
+
+            QList<QByteArray> originalBlocks;
 
             for (quint32 block = 0; block < forkBlocks; ++block)
             {
-                int originalBlockLength = originalDataStream.readRawData(originalDataBlock.data(), CHUNK);
+                originalBlocks << QByteArray::fromRawData(originalData.constData() + block * CHUNK,
+                                                          qMin((quint32)CHUNK, forkLength - block * CHUNK));
+            }
 
-                QByteArray compressedDataBlock = qCompress((const uchar*)originalDataBlock.data(), originalBlockLength, -1);
-                compressedDataBlock.remove(0, 4); // removes qCompress own header
-                qCDebug(DIGIKAM_GENERAL_LOG) << "DNGWriter: compressed data block " << originalBlockLength << " -> " << compressedDataBlock.size();
+            QList<QByteArray> compressedBlocks = QtConcurrent::blockingMapped(originalBlocks, &Private::compressBlock);
+
+            if (d->cancel)
+                return PROCESSCANCELED;
+
+            QVector<quint32> offsets;
+            quint32 offset = (2 + forkBlocks) * sizeof(quint32);
+            offsets.push_back(offset);
 
+            foreach (const QByteArray& compressedDataBlock, compressedBlocks)
+            {
                 offset += compressedDataBlock.size();
                 offsets.push_back(offset);
-
-                compressedDataStream.writeRawData(compressedDataBlock.data(), compressedDataBlock.size());
             }
 
+            qCDebug(DIGIKAM_GENERAL_LOG) << "DNGWriter: compressed" << forkBlocks << "data blocks:" << forkLength
+                                         << "->" << offset - offsets.first() << "bytes";
+
             dng_memory_allocator memalloc(gDefaultDNGMemoryAllocator);
             dng_memory_stream tempDataStream(memalloc);
             tempDataStream.SetBigEndian(true);
@@ -1107,14 +1114,14 @@ int DNGWriter::convert()
                 tempDataStream.Put_uint32(offsets[idx]);
             }
 
-            QByteArray compressedData;
-            compressedData.resize(compressedFile.size());
-            compressedFile.seek(0);
-            compressedDataStream.readRawData(compressedData.data(), compressedData.size());
-            tempDataStream.Put(compressedData.data(), compressedData.size());
+            foreach (const QByteArray& compressedDataBlock, compressedBlocks)
+            {
+                tempDataStream.Put(compressedDataBlock.constData(), compressedDataBlock.size());
+            }
 
-            compressedFile.remove();
-            originalFile.close();
+            compressedBlocks.clear();
+            originalBlocks.clear();
+            originalData.clear();
 
             tempDataStream.Put_uint32(0);
             tempDataStream.Put_uint32(0);
@@ -1193,35 +1200,28 @@ int DNGWriter::convert()
                 return PROCESSFAILED;
             }
 
-            QTemporaryFile previewFile;
+            // Encode the JPEG preview in memory.
+            QByteArray previewData;
+            QBuffer    previewBuffer(&previewData);
+            previewBuffer.open(QIODevice::WriteOnly);
 
-            if (!previewFile.open())
+            if (!pre_image.save(&previewBuffer, "JPEG", 90))
             {
-                qCDebug(DIGIKAM_GENERAL_LOG) << "DNGWriter: Cannot open temporary file to write JPEG preview. Aborted..." ;
+                qCDebug(DIGIKAM_GENERAL_LOG) << "DNGWriter: Cannot encode JPEG preview. Aborted..." ;
                 return PROCESSFAILED;
             }
 
-            if (!pre_image.save(previewFile.fileName(), "JPEG", 90))
-            {
-                qCDebug(DIGIKAM_GENERAL_LOG) << "DNGWriter: Cannot save file to write JPEG preview. Aborted..." ;
-                return PROCESSFAILED;
-            }
-
-            // Load JPEG preview file data in DNG preview container.
+            // Load JPEG preview data in DNG preview container.
             AutoPtr<dng_jpeg_preview> jpeg_preview;
             jpeg_preview.Reset(new dng_jpeg_preview);
             jpeg_preview->fPhotometricInterpretation = piYCbCr;
             jpeg_preview->fPreviewSize.v             = pre_image.height();
             jpeg_preview->fPreviewSize.h             = pre_image.width();
-            jpeg_preview->fCompressedData.Reset(host.Allocate(previewFile.size()));
-
-            QDataStream previewStream( &previewFile );
-            previewStream.readRawData(jpeg_preview->fCompressedData->Buffer_char(), previewFile.size());
+            jpeg_preview->fCompressedData.Reset(host.Allocate(previewData.size()));
+            memcpy(jpeg_preview->fCompressedData->Buffer_char(), previewData.constData(), previewData.size());
 
             AutoPtr<dng_preview> pp( dynamic_cast<dng_preview*>(jpeg_preview.Release()) );
             previewList.Append(pp);
-
-            previewFile.remove();
         }
 
         if (d->cancel)
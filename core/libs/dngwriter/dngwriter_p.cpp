@@ -101,4 +101,12 @@ bool DNGWriter::Private::fujiRotate(QByteArray& rawData, DRawInfo& identify) con
     return true;
 }
 
+QByteArray DNGWriter::Private::compressBlock(const QByteArray& block)
+{
+    QByteArray compressedBlock = qCompress((const uchar*)block.constData(), block.size(), -1);
+    compressedBlock.remove(0, 4); // removes qCompress own header
+
+    return compressedBlock;
+}
+
 } // namespace Digikam
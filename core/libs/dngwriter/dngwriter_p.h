@@ -91,6 +91,12 @@ public:
 
     bool fujiRotate(QByteArray& rawData, DRawInfo& identify) const;
 
+    /**
+     * Compress a block of the original RAW file to embed in DNG: zlib stream without
+     * the qCompress() size header. Thread-safe.
+     */
+    static QByteArray compressBlock(const QByteArray& block);
+
 public:
 
     bool    cancel;
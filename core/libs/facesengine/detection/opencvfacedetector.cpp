@@ -255,6 +255,7 @@ public:
         minDuplicates            = 0;
         speedVsAccuracy          = 0.8;
         sensitivityVsSpecificity = 0.8;
+        twoStage                 = false;
     }
 
 public:
@@ -270,6 +271,7 @@ public:
 
     double                 speedVsAccuracy;
     double                 sensitivityVsSpecificity;
+    bool                   twoStage;
 
     QMutex                 mutex;
 };
@@ -330,6 +332,16 @@ void OpenCVFaceDetector::setSpecificity(double sensitivityVsSpecificity)
     d->sensitivityVsSpecificity = qBound(0.0, sensitivityVsSpecificity, 1.0);
 }
 
+void OpenCVFaceDetector::setTwoStageDetection(bool twoStage)
+{
+    d->twoStage = twoStage;
+}
+
+bool OpenCVFaceDetector::twoStageDetection() const
+{
+    return d->twoStage;
+}
+
 void OpenCVFaceDetector::updateParameters(const cv::Size& /*scaledSize*/, const cv::Size& originalSize)
 {
     double origSize = double(cv::max(originalSize.width, originalSize.height)) / 1000;
@@ -617,16 +629,8 @@ QList<QRect> OpenCVFaceDetector::mergeFaces(const cv::Mat& inputImage, const QLi
         results += list;
     }
 
-    // used only one cascade? No need to merge then
-    int primaryCascades = 0;
-
-    foreach (const Cascade& cascade, d->cascades)
-    {
-        if (cascade.primaryCascade)
-            primaryCascades++;
-    }
-
-    if (primaryCascades <= 1)
+    // only one list of results, from a single cascade? No need to merge then
+    if (combo.size() <= 1)
     {
         return results;
     }
@@ -681,6 +685,101 @@ int OpenCVFaceDetector::recommendedImageSizeForDetection()
     return 800;
 }
 
+int OpenCVFaceDetector::twoStageScanSize()
+{
+    return 200;
+}
+
+QList<QRect> OpenCVFaceDetector::reducedScaleCandidates(const cv::Mat& inputImage)
+{
+    const int longSide = cv::max(inputImage.cols, inputImage.rows);
+    const double scale = double(twoStageScanSize()) / longSide;
+
+    cv::Mat reduced;
+    cv::resize(inputImage, reduced, cv::Size(lround(inputImage.cols * scale), lround(inputImage.rows * scale)),
+               0, 0, cv::INTER_AREA);
+
+    // The minimum face size shrinks with the image, passing 0 uses the cascade minimum.
+    DetectObjectParameters params = d->primaryParams;
+    params.minSize                = cv::Size(lround(params.minSize.width  * scale),
+                                             lround(params.minSize.height * scale));
+
+    if (params.minSize.width < 20 || params.minSize.height < 20)
+    {
+        params.minSize = cv::Size(0, 0);
+    }
+
+    QList<QList<QRect> > primaryResults;
+
+    for (int i = 0 ; i < d->cascades.size() ; ++i)
+    {
+        if (d->cascades[i].primaryCascade)
+        {
+            primaryResults << cascadeResult(reduced, d->cascades[i], params);
+        }
+    }
+
+    QList<QRect> candidates;
+
+    foreach (const QRect& rect, mergeFaces(reduced, primaryResults))
+    {
+        candidates << QRect(lround(rect.x()      / scale),
+                            lround(rect.y()      / scale),
+                            lround(rect.width()  / scale),
+                            lround(rect.height() / scale))
+                      .intersected(QRect(0, 0, inputImage.cols, inputImage.rows));
+    }
+
+    qCDebug(DIGIKAM_FACESENGINE_LOG) << "Two-stage detection: candidates" << candidates
+                                     << "found at scale" << scale;
+
+    return candidates;
+}
+
+QRect OpenCVFaceDetector::refineCandidate(const cv::Mat& inputImage, const QRect& candidate)
+{
+    // The candidate is only approximate at the reduced scale, search in a larger region around it.
+    const int margin = candidate.width() / 4;
+    QRect region     = candidate.adjusted(-margin, -margin, margin, margin)
+                       .intersected(QRect(0, 0, inputImage.cols, inputImage.rows));
+
+    if (region.isEmpty())
+    {
+        return candidate;
+    }
+
+    cv::Mat roiImg                = inputImage(fromQRect(region));
+
+    DetectObjectParameters params = d->primaryParams;
+    params.searchIncrement        = 1.1;
+    params.grouping               = 2;
+    params.minSize                = cv::Size(lround(candidate.width()  * 0.6),
+                                             lround(candidate.height() * 0.6));
+
+    QRect best;
+
+    for (int i = 0 ; i < d->cascades.size() ; ++i)
+    {
+        if (d->cascades[i].primaryCascade)
+        {
+            foreach (const QRect& rect, cascadeResult(roiImg, d->cascades[i], params))
+            {
+                if (rect.width() * rect.height() > best.width() * best.height())
+                {
+                    best = rect;
+                }
+            }
+        }
+    }
+
+    if (best.isNull())
+    {
+        return candidate;
+    }
+
+    return best.translated(region.topLeft());
+}
+
 cv::Mat OpenCVFaceDetector::prepareForDetection(const QImage& inputImage) const
 {
     if (inputImage.isNull() || !inputImage.size().isValid())
@@ -783,20 +882,37 @@ QList<QRect> OpenCVFaceDetector::detectFaces(const cv::Mat& inputImage, const cv
 
     updateParameters(inputImage.size(), originalSize);
 
-    // Now loop through each cascade, apply it, and get back a vector of detected faces
-    QList<QList<QRect> > primaryResults;
     QList<QRect> results;
 
-    for (int i = 0 ; i < d->cascades.size() ; ++i)
+    if (d->twoStage && (cv::max(inputImage.cols, inputImage.rows) > twoStageScanSize()))
     {
-        if (d->cascades[i].primaryCascade)
+        // Fast scan at reduced scale, then each candidate is located at full scale.
+        QList<QList<QRect> > refinedResults;
+
+        foreach (const QRect& candidate, reducedScaleCandidates(inputImage))
         {
-            primaryResults << cascadeResult(inputImage, d->cascades[i], d->primaryParams);
+            refinedResults << (QList<QRect>() << refineCandidate(inputImage, candidate));
         }
+
+        // Merge the refined candidates which found the same face.
+        results = mergeFaces(inputImage, refinedResults);
     }
+    else
+    {
+        // Now loop through each cascade, apply it, and get back a vector of detected faces
+        QList<QList<QRect> > primaryResults;
 
-    // Merge overlaps of face regions by different cascades.
-    results = mergeFaces(inputImage, primaryResults);
+        for (int i = 0 ; i < d->cascades.size() ; ++i)
+        {
+            if (d->cascades[i].primaryCascade)
+            {
+                primaryResults << cascadeResult(inputImage, d->cascades[i], d->primaryParams);
+            }
+        }
+
+        // Merge overlaps of face regions by different cascades.
+        results = mergeFaces(inputImage, primaryResults);
+    }
 
     // Verify faces using other cascades
     for (QList<QRect>::iterator it = results.begin() ; it != results.end() ; )
@@ -78,12 +78,30 @@ public:
     double accuracy()    const;
     double specificity() const;
 
+    /**
+     * Enables the two-stage detection: the primary cascades run on a strongly
+     * downscaled copy of the image, then each candidate is located again on its
+     * region of the full image before verification. Much faster on large images,
+     * at the cost of missing the smallest faces. See twoStageScanSize() for the scale.
+     */
+    void setTwoStageDetection(bool twoStage);
+    bool twoStageDetection() const;
+
     /**
      * Returns the image size (one dimension)
      * recommended for face detection. If the image is considerably larger, it will be rescaled automatically.
      */
     static int recommendedImageSizeForDetection();
 
+    /**
+     * Returns the image size (one dimension) used for the first pass of the two-stage detection.
+     * The detection input is already scaled to recommendedImageSizeForDetection(), and to at most
+     * 1024x768 pixels by prepareForDetection(): the first pass runs at 1/4 of the size of a
+     * 800 pixels input, 1/6 of the largest one. With the cascade minimum of 20 pixels, it only
+     * finds faces of about 80 pixels or more in a 800 pixels input.
+     */
+    static int twoStageScanSize();
+
 private:
 
     /**
@@ -99,7 +117,8 @@ private:
     bool verifyFace(const cv::Mat& inputImage, const QRect& face) const;
 
     /**
-     * Returns the faces from the detection results of multiple cascades
+     * Returns the faces from the detection results of multiple cascades, or of the refined candidates
+     * of the two-stage detection, one list per candidate
      *
      * @param combo A vector of a vector of faces, each component vector is the detection result of a single cascade
      * @param maxdist The maximum allowable distance between two duplicates, if two faces are further apart than this, they are not duplicates
@@ -108,6 +127,19 @@ private:
      */
     QList<QRect> mergeFaces(const cv::Mat& inputImage, const QList< QList<QRect> >& preliminaryResults) const;
 
+    /**
+     * First stage of the two-stage detection: returns the candidate faces found by the primary
+     * cascades on a downscaled copy of the image, in coordinates of the input image.
+     */
+    QList<QRect> reducedScaleCandidates(const cv::Mat& inputImage);
+
+    /**
+     * Second stage of the two-stage detection: locates a candidate face again with the primary
+     * cascades on its region of the input image. Returns the candidate if nothing is found there.
+     * Several candidates can converge on the same face: the results go through mergeFaces().
+     */
+    QRect refineCandidate(const cv::Mat& inputImage, const QRect& candidate);
+
     void updateParameters(const cv::Size& scaledSize, const cv::Size& originalSize);
 
 private:
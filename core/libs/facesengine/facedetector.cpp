@@ -97,6 +97,10 @@ public:
             {
                 backend()->setSpecificity(1.0 - it.value().toDouble());
             }
+            else if (it.key() == QLatin1String("twostage"))
+            {
+                backend()->setTwoStageDetection(it.value().toBool());
+            }
         }
     }
 
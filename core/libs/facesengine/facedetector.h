@@ -92,6 +92,9 @@ public:
      * For both pairs: a = 1-b, you can set either.
      * The first pair changes the ROC curve in a trade for computing time.
      * The second pair moves on a given ROC curve towards more false positives, or more missed faces.
+     *
+     * "twostage", bool: scan a strongly downscaled image first, then locate and verify
+     * the candidate faces at full scale. Faster on large images, misses the smallest faces.
      */
     void        setParameter(const QString& parameter, const QVariant& value);
     void        setParameters(const QVariantMap& parameters);
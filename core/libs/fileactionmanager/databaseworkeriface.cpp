@@ -31,11 +31,15 @@
 
 #include "digikam_debug.h"
 #include "collectionscanner.h"
+#include "coredbaccess.h"
+#include "coredb.h"
 #include "coredboperationgroup.h"
+#include "coredbtransaction.h"
 #include "iteminfotasksplitter.h"
 #include "fileactionmngr_p.h"
 #include "scancontroller.h"
 #include "disjointmetadata.h"
+#include "metaenginesettings.h"
 
 namespace Digikam
 {
@@ -53,46 +57,52 @@ void FileActionMngrDatabaseWorker::removeTags(FileActionItemInfoList infos, cons
 void FileActionMngrDatabaseWorker::changeTags(FileActionItemInfoList infos,
                                               const QList<int>& tagIDs, bool addOrRemove)
 {
-    DisjointMetadata hub;
-    QList<ItemInfo> forWriting;
+    QList<ItemInfo>  forWriting;
+    QList<qlonglong> imageIds;
 
+    // The tags are changed for all the items at once: one transaction and one changeset,
+    // instead of one DisjointMetadata write and one changeset per item and tag.
+
+    foreach (const ItemInfo& info, infos)
     {
-        CoreDbOperationGroup group;
-        group.setMaximumTime(200);
+        if (!info.isNull())
+        {
+            imageIds << info.id();
+        }
+    }
 
-        foreach (const ItemInfo& info, infos)
+    if (state() != WorkerObject::Deactivating && !imageIds.isEmpty())
+    {
+        CoreDbAccess access;
+
+        if (addOrRemove)
         {
-            if (state() == WorkerObject::Deactivating)
-            {
-                break;
-            }
+            access.db()->addTagsToItems(imageIds, tagIDs);
+            access.db()->addRecentlyAssignedTags(tagIDs);
+        }
+        else
+        {
+            CoreDbTransaction transaction(&access);
+            access.db()->removeTagsFromItems(imageIds, tagIDs);
+            access.db()->removeTagPropertiesFromItems(imageIds, tagIDs);
+        }
 
-            hub.load(info);
+        // Tags have changed for all items: the files are written if the settings ask for tags.
 
-            for (QList<int>::const_iterator tagIt = tagIDs.constBegin(); tagIt != tagIDs.constEnd(); ++tagIt)
+        if (MetaEngineSettings::instance()->settings().saveTags)
+        {
+            foreach (const ItemInfo& info, infos)
             {
-                if (addOrRemove)
+                if (!info.isNull() && d->shallSendForWriting(info.id(), MetadataHub::WRITE_TAGS))
                 {
-                    hub.setTag(*tagIt, DisjointMetadata::MetadataAvailable);
+                    forWriting << info;
                 }
-                else
-                {
-                    hub.setTag(*tagIt, DisjointMetadata::MetadataInvalid);
-                }
-            }
-
-            hub.write(info, DisjointMetadata::PartialWrite);
-
-            if (hub.willWriteMetadata(DisjointMetadata::FullWriteIfChanged) && d->shallSendForWriting(info.id()))
-            {
-                forWriting << info;
             }
-
-            infos.dbProcessedOne();
-            group.allowLift();
         }
     }
 
+    infos.dbProcessed(infos.size());
+
     // send for writing file metadata
     if (!forWriting.isEmpty())
     {
@@ -130,7 +140,7 @@ void FileActionMngrDatabaseWorker::assignPickLabel(FileActionItemInfoList infos,
             hub.setPickLabel(pickId);
             hub.write(info, DisjointMetadata::PartialWrite);
 
-            if (hub.willWriteMetadata(DisjointMetadata::FullWriteIfChanged) && d->shallSendForWriting(info.id()))
+            if (hub.willWriteMetadata(DisjointMetadata::FullWriteIfChanged) && d->shallSendForWriting(info.id(), MetadataHub::WRITE_PICKLABEL))
             {
                 forWriting << info;
             }
@@ -175,7 +185,7 @@ void FileActionMngrDatabaseWorker::assignColorLabel(FileActionItemInfoList infos
             hub.setColorLabel(colorId);
             hub.write(info, DisjointMetadata::PartialWrite);
 
-            if (hub.willWriteMetadata(DisjointMetadata::FullWriteIfChanged) && d->shallSendForWriting(info.id()))
+            if (hub.willWriteMetadata(DisjointMetadata::FullWriteIfChanged) && d->shallSendForWriting(info.id(), MetadataHub::WRITE_COLORLABEL))
             {
                 forWriting << info;
             }
@@ -221,7 +231,7 @@ void FileActionMngrDatabaseWorker::assignRating(FileActionItemInfoList infos, in
             hub.setRating(rating);
             hub.write(info, DisjointMetadata::PartialWrite);
 
-            if (hub.willWriteMetadata(DisjointMetadata::FullWriteIfChanged) && d->shallSendForWriting(info.id()))
+            if (hub.willWriteMetadata(DisjointMetadata::FullWriteIfChanged) && d->shallSendForWriting(info.id(), MetadataHub::WRITE_RATING))
             {
                 forWriting << info;
             }
@@ -78,6 +78,10 @@ FileActionMngr::~FileActionMngr()
 
 bool FileActionMngr::requestShutDown()
 {
+    // Do not wait for the end of the coalescing window: the queued writes are sent
+    // to the file workers now, and they are still active until the tasks are finished.
+    d->slotFlushMetadataWrites();
+
     if (!isActive())
     {
         shutDown();
@@ -112,6 +116,29 @@ bool FileActionMngr::isActive()
     return d->isActive();
 }
 
+int FileActionMngr::pendingMetadataWrites() const
+{
+    QMutexLocker lock(&d->mutex);
+    return d->scheduledToWrite.size();
+}
+
+int FileActionMngr::writtenMetadataFiles() const
+{
+    return d->writtenFiles.load();
+}
+
+double FileActionMngr::metadataWriteThroughput() const
+{
+    QMutexLocker lock(&d->mutex);
+
+    if (!d->busyClock.isValid() || (d->busyClock.elapsed() == 0))
+    {
+        return 0.0;
+    }
+
+    return (d->busyWrittenFiles * 1000.0 / d->busyClock.elapsed());
+}
+
 void FileActionMngr::assignTags(const QList<qlonglong>& ids, const QList<int>& tagIDs)
 {
     assignTags(ItemInfoList(ids), tagIDs);
@@ -59,6 +59,20 @@ public:
     void shutDown();
     bool isActive();
 
+    /** The metadata writes to the files are queued for a short time, the changes done
+     *  meanwhile to the same items are coalesced and written with one file write.
+     *  These counters can be used to monitor the write queue.
+     */
+
+    /// Number of items waiting for their metadata to be written to the files
+    int pendingMetadataWrites() const;
+
+    /// Number of files written since the start
+    int writtenMetadataFiles() const;
+
+    /// Files written per second since the write queue became busy
+    double metadataWriteThroughput() const;
+
 Q_SIGNALS:
 
     void signalImageChangeFailed(const QString& message, const QStringList& fileNames);
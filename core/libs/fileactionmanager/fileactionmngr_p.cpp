@@ -38,7 +38,10 @@ namespace Digikam
 {
 
 FileActionMngr::Private::Private(FileActionMngr* const qq)
-    : q(qq)
+    : writeWindowTimer(0),
+      writtenFiles(0),
+      busyWrittenFiles(0),
+      q(qq)
 {
     qRegisterMetaType<MetadataHub*>("MetadataHub*");
     qRegisterMetaType<FileActionItemInfoList>("FileActionItemInfoList");
@@ -57,6 +60,13 @@ FileActionMngr::Private::Private(FileActionMngr* const qq)
     sleepTimer->setSingleShot(true);
     sleepTimer->setInterval(1000);
 
+    // Metadata writes are delayed for a short time: the items changed again meanwhile
+    // are coalesced by shallSendForWriting() and their file is written once.
+
+    writeWindowTimer = new QTimer(this);
+    writeWindowTimer->setSingleShot(true);
+    writeWindowTimer->setInterval(500);
+
     connectToDatabaseWorker();
 
     connectDatabaseToFileWorker();
@@ -76,6 +86,13 @@ FileActionMngr::Private::Private(FileActionMngr* const qq)
 
     connect(sleepTimer, SIGNAL(timeout()),
             this, SLOT(slotSleepTimer()));
+
+    connect(this, SIGNAL(signalMetadataWriteQueued()),
+            this, SLOT(slotStartWriteWindow()),
+            Qt::QueuedConnection);
+
+    connect(writeWindowTimer, SIGNAL(timeout()),
+            this, SLOT(slotFlushMetadataWrites()));
 }
 
 void FileActionMngr::Private::connectToDatabaseWorker()
@@ -116,6 +133,10 @@ void FileActionMngr::Private::connectDatabaseToFileWorker()
             Qt::DirectConnection);
 
     connect(dbWorker, SIGNAL(writeMetadata(FileActionItemInfoList,int)),
+            this, SLOT(slotQueueMetadataWrite(FileActionItemInfoList,int)),
+            Qt::DirectConnection);
+
+    connect(this, SIGNAL(signalWriteMetadata(FileActionItemInfoList,int)),
             fileWorker, SLOT(writeMetadata(FileActionItemInfoList,int)),
             Qt::DirectConnection);
 
@@ -136,26 +157,95 @@ bool FileActionMngr::Private::isActive() const
     return dbProgress.activeProgressItems || fileProgress.activeProgressItems;
 }
 
-bool FileActionMngr::Private::shallSendForWriting(qlonglong id)
+bool FileActionMngr::Private::shallSendForWriting(qlonglong id, int flags)
 {
     QMutexLocker lock(&mutex);
 
-    if (scheduledToWrite.contains(id))
+    // Coalesce with the write already scheduled for this item: the file is written once.
+
+    QHash<qlonglong, int>::iterator it = scheduledToWrite.find(id);
+
+    if (it != scheduledToWrite.end())
     {
+        it.value() |= flags;
         return false;
     }
 
-    scheduledToWrite << id;
+    // A new busy period of the write queue starts: restart the throughput counter.
+
+    if (scheduledToWrite.isEmpty() && !fileProgress.activeProgressItems)
+    {
+        busyWrittenFiles = 0;
+        busyClock.start();
+    }
+
+    scheduledToWrite.insert(id, flags);
     return true;
 }
 
-void FileActionMngr::Private::startingToWrite(const QList<ItemInfo>& infos)
+QHash<qlonglong, int> FileActionMngr::Private::startingToWrite(const QList<ItemInfo>& infos)
 {
     QMutexLocker lock(&mutex);
+    QHash<qlonglong, int> flags;
 
     foreach (const ItemInfo& info, infos)
     {
-        scheduledToWrite.remove(info.id());
+        QHash<qlonglong, int>::iterator it = scheduledToWrite.find(info.id());
+
+        if (it != scheduledToWrite.end())
+        {
+            flags.insert(info.id(), it.value());
+            scheduledToWrite.erase(it);
+        }
+    }
+
+    return flags;
+}
+
+void FileActionMngr::Private::writtenToFile()
+{
+    writtenFiles.ref();
+
+    QMutexLocker lock(&mutex);
+    ++busyWrittenFiles;
+}
+
+void FileActionMngr::Private::slotQueueMetadataWrite(const FileActionItemInfoList& infos, int flags)
+{
+    {
+        QMutexLocker lock(&mutex);
+        queuedWrites << qMakePair(infos, flags);
+    }
+
+    emit signalMetadataWriteQueued();
+}
+
+void FileActionMngr::Private::slotStartWriteWindow()
+{
+    // The window is not restarted by new writes, the first queued write waits at most one interval.
+
+    if (!writeWindowTimer->isActive())
+    {
+        writeWindowTimer->start();
+    }
+}
+
+void FileActionMngr::Private::slotFlushMetadataWrites()
+{
+    QList<QPair<FileActionItemInfoList, int> > writes;
+
+    {
+        QMutexLocker lock(&mutex);
+        writes.swap(queuedWrites);
+    }
+
+    writeWindowTimer->stop();
+
+    // The file worker distributes the tasks to its workers, which write the files in parallel.
+
+    for (int i = 0 ; i < writes.size() ; ++i)
+    {
+        emit signalWriteMetadata(writes.at(i).first, writes.at(i).second);
     }
 }
 
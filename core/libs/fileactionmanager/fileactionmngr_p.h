@@ -27,7 +27,10 @@
 
 // Qt includes
 
+#include <QElapsedTimer>
+#include <QHash>
 #include <QMutex>
+#include <QPair>
 #include <QSet>
 #include <QTimer>
 
@@ -98,6 +101,12 @@ Q_SIGNALS:
     void signalTransform(const FileActionItemInfoList& infos, int orientation);
     void signalCopyAttributes(const FileActionItemInfoList& infos, const QStringList& derivedPaths);
 
+    // Connected to the file worker, when the coalescing window of the write queue ends
+    void signalWriteMetadata(const FileActionItemInfoList& infos, int flags);
+
+    // Queued to the thread of this object to start the coalescing window
+    void signalMetadataWriteQueued();
+
 public:
 
     // -- Signal-emitter glue code --
@@ -158,11 +167,15 @@ public:
 
     bool isActive() const;
 
-    /// db worker will send info to file worker if returns true
-    bool shallSendForWriting(qlonglong id);
+    /// db worker will send info to file worker if returns true.
+    /// If a write is already scheduled for the item, the flags are added to this write.
+    bool shallSendForWriting(qlonglong id, int flags = MetadataHub::WRITE_ALL);
+
+    /// file worker calls this when receiving a task, returns the write flags scheduled by item id
+    QHash<qlonglong, int> startingToWrite(const QList<ItemInfo>& infos);
 
-    /// file worker calls this when receiving a task
-    void startingToWrite(const QList<ItemInfo>& infos);
+    /// file worker calls this for each file written
+    void writtenToFile();
 
     void connectToDatabaseWorker();
     void connectDatabaseToFileWorker();
@@ -176,9 +189,23 @@ public Q_SLOTS:
     void slotSleepTimer();
     void slotLastProgressItemCompleted();
 
+    /// db worker writes are queued here, and sent to the file worker when the window ends
+    void slotQueueMetadataWrite(const FileActionItemInfoList& infos, int flags);
+    void slotStartWriteWindow();
+    void slotFlushMetadataWrites();
+
 public:
 
-    QSet<qlonglong>                       scheduledToWrite;
+    QHash<qlonglong, int>                 scheduledToWrite;
+
+    /// The metadata writes waiting for the end of the coalescing window
+    QList<QPair<FileActionItemInfoList, int> > queuedWrites;
+    QTimer*                               writeWindowTimer;
+
+    /// Write queue counters
+    QAtomicInt                            writtenFiles;
+    int                                   busyWrittenFiles;
+    QElapsedTimer                         busyClock;
     QString                               dbMessage;
     QString                               writerMessage;
     QMutex                                mutex;
@@ -111,6 +111,7 @@ void FileActionMngrFileWorker::writeMetadataToFiles(FileActionItemInfoList infos
 
         // hub emits fileMetadataChanged
         infos.writtenToOne();
+        d->writtenToFile();
     }
 
     ScanController::instance()->resumeCollectionScan();
@@ -120,7 +121,7 @@ void FileActionMngrFileWorker::writeMetadataToFiles(FileActionItemInfoList infos
 
 void FileActionMngrFileWorker::writeMetadata(FileActionItemInfoList infos, int flags)
 {
-    d->startingToWrite(infos);
+    QHash<qlonglong, int> scheduledFlags = d->startingToWrite(infos);
 
     ScanController::instance()->suspendCollectionScan();
 
@@ -134,19 +135,24 @@ void FileActionMngrFileWorker::writeMetadata(FileActionItemInfoList infos, int f
         }
 
         hub.load(info);
+
+        // The changes coalesced with this write are written too.
+        MetadataHub::WriteComponents components = (MetadataHub::WriteComponents)(flags | scheduledFlags.value(info.id()));
+
         // apply to file metadata
         if (MetaEngineSettings::instance()->settings().useLazySync)
         {
-            hub.writeToMetadata(info, (MetadataHub::WriteComponents)flags);
+            hub.writeToMetadata(info, components);
         }
         else
         {
             ScanController::FileMetadataWrite writeScope(info);
-            writeScope.changed(hub.writeToMetadata(info, (MetadataHub::WriteComponents)flags));
+            writeScope.changed(hub.writeToMetadata(info, components));
         }
 
         // hub emits fileMetadataChanged
         infos.writtenToOne();
+        d->writtenToFile();
     }
 
     ScanController::instance()->resumeCollectionScan();
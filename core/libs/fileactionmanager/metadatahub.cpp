@@ -254,7 +254,8 @@ bool MetadataHub::writeToMetadata(const ItemInfo& info, WriteComponent writeMode
 
     writeToBaloo(info.filePath());
 
-    DMetadata metadata(info.filePath());
+    DMetadata metadata;
+    loadForWriting(metadata, info.filePath(), settings);
 
     if (write(metadata, writeMode, settings))
     {
@@ -369,7 +370,8 @@ bool MetadataHub::write(const QString& filePath, WriteComponent writeMode, bool
 
     writeToBaloo(filePath);
 
-    DMetadata metadata(filePath);
+    DMetadata metadata;
+    loadForWriting(metadata, filePath, settings);
 
     if (write(metadata, writeMode, settings))
     {
@@ -429,8 +431,8 @@ bool MetadataHub::writeTags(const QString& filePath, WriteComponent writeMode,
         return false;
     }
 
-    DMetadata metadata(filePath);
-    metadata.setSettings(settings);
+    DMetadata metadata;
+    loadForWriting(metadata, filePath, settings);
     bool saveFaces = settings.saveFaceTags;
     bool saveTags  = settings.saveTags;
 
@@ -457,6 +459,25 @@ bool MetadataHub::writeTags(const QString& filePath, WriteComponent writeMode,
     }
 }
 
+void MetadataHub::loadForWriting(DMetadata& metadata, const QString& filePath,
+                                 const MetaEngineSettingsContainer& settings)
+{
+    metadata.setSettings(settings);
+
+    // The sidecar holds all the metadata written before, the image file
+    // does not need to be parsed again to update it.
+
+    if ((settings.metadataWritingMode == MetaEngine::WRITE_TO_SIDECAR_ONLY) &&
+        settings.useXMPSidecar4Reading                                      &&
+        DMetadata::hasSidecar(filePath)                                     &&
+        metadata.loadFromSidecarAndMerge(filePath))
+    {
+        return;
+    }
+
+    metadata.load(filePath);
+}
+
 bool MetadataHub::writeTags(DMetadata& metadata, bool saveTags)
 {
     qCDebug(DIGIKAM_GENERAL_LOG) << "Writing tags";
@@ -263,6 +263,14 @@ protected:
     bool write(DMetadata& metadata, WriteComponent writeMode = WRITE_ALL,
                const MetaEngineSettingsContainer& settings = MetaEngineSettings::instance()->settings());
 
+    /**
+        Loads the metadata of the file to which the changes are written.
+        If the settings write to the XMP sidecar only and the sidecar exists,
+        only the sidecar is read: the image file is not parsed at all.
+    */
+    static void loadForWriting(DMetadata& metadata, const QString& filePath,
+                               const MetaEngineSettingsContainer& settings);
+
     void load(const QDateTime& dateTime,
               const CaptionsMap& titles, const CaptionsMap& comment,
               int colorLabel, int pickLabel,
@@ -81,7 +81,12 @@ bool MetaEngine::initializeExiv2()
 {
 #ifdef _XMP_SUPPORT_
 
-    if (!Exiv2::XmpParser::initialize())
+    QMutexLocker lock(&s_metaEngineMutex);
+
+    // The XMP toolkit is not thread-safe: Exiv2 will call the lock function around all
+    // its calls, so MetaEngine instances do not need to lock themselves.
+
+    if (!Exiv2::XmpParser::initialize(MetaEngine::Private::xmpToolkitLock, &s_metaEngineMutex))
         return false;
 
     registerXmpNameSpace(QLatin1String("http://ns.adobe.com/lightroom/1.0/"),  QLatin1String("lr"));
@@ -100,6 +105,8 @@ bool MetaEngine::cleanupExiv2()
     // Fix memory leak if Exiv2 support XMP.
 #ifdef _XMP_SUPPORT_
 
+    QMutexLocker lock(&s_metaEngineMutex);
+
     unregisterXmpNameSpace(QLatin1String("http://ns.adobe.com/lightroom/1.0/"));
     unregisterXmpNameSpace(QLatin1String("http://www.digikam.org/ns/kipi/1.0/"));
     unregisterXmpNameSpace(QLatin1String("http://ns.microsoft.com/photo/1.2/"));
@@ -190,8 +197,6 @@ bool MetaEngine::loadFromData(const QByteArray& imgData)
     if (imgData.isEmpty())
         return false;
 
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::Image::AutoPtr image = Exiv2::ImageFactory::open((Exiv2::byte*)imgData.data(), imgData.size());
@@ -177,6 +177,8 @@ public:
      *  This method must be called before using libMetaEngine with multithreading.
      *  It initialize several non re-entrancy code from Adobe XMP SDK
      *  See Bug #166424 for details. Call cleanupExiv2() to clean things up later.
+     *  Calls to the XMP toolkit are then serialized by Exiv2, and separated MetaEngine
+     *  instances can read and write metadata in parallel.
      */
     static bool initializeExiv2();
 
@@ -34,8 +34,6 @@ namespace Digikam
 
 bool MetaEngine::canWriteComment(const QString& filePath)
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::Image::AutoPtr image = Exiv2::ImageFactory::open((const char*)
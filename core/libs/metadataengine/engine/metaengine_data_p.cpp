@@ -34,8 +34,6 @@ namespace Digikam
 
 void MetaEngineData::Private::clear()
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         imageComments.clear();
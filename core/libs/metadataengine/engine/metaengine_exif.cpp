@@ -45,8 +45,6 @@ namespace Digikam
 
 bool MetaEngine::canWriteExif(const QString& filePath)
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::Image::AutoPtr image = Exiv2::ImageFactory::open((const char*)
@@ -77,8 +75,6 @@ bool MetaEngine::hasExif() const
 
 bool MetaEngine::clearExif() const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         d->exifMetadata().clear();
@@ -98,8 +94,6 @@ bool MetaEngine::clearExif() const
 
 QByteArray MetaEngine::getExifEncoded(bool addExifHeader) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         if (!d->exifMetadata().empty())
@@ -142,8 +136,6 @@ QByteArray MetaEngine::getExifEncoded(bool addExifHeader) const
 
 bool MetaEngine::setExif(const QByteArray& data) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         if (!data.isEmpty())
@@ -169,8 +161,6 @@ bool MetaEngine::setExif(const QByteArray& data) const
 
 QString MetaEngine::getExifComment(bool readDescription) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         if (!d->exifMetadata().empty())
@@ -241,8 +231,6 @@ static bool is7BitAscii(const QByteArray& s)
 
 bool MetaEngine::setExifComment(const QString& comment, bool writeDescription) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         if (writeDescription)
@@ -295,8 +283,6 @@ bool MetaEngine::setExifComment(const QString& comment, bool writeDescription) c
 
 QString MetaEngine::getExifTagTitle(const char* exifTagName)
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         std::string exifkey(exifTagName);
@@ -318,8 +304,6 @@ QString MetaEngine::getExifTagTitle(const char* exifTagName)
 
 QString MetaEngine::getExifTagDescription(const char* exifTagName)
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         std::string exifkey(exifTagName);
@@ -341,8 +325,6 @@ QString MetaEngine::getExifTagDescription(const char* exifTagName)
 
 bool MetaEngine::removeExifTag(const char* exifTagName) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::ExifKey exifKey(exifTagName);
@@ -368,8 +350,6 @@ bool MetaEngine::removeExifTag(const char* exifTagName) const
 
 bool MetaEngine::getExifTagRational(const char* exifTagName, long int& num, long int& den, int component) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::ExifKey exifKey(exifTagName);
@@ -399,8 +379,6 @@ bool MetaEngine::getExifTagRational(const char* exifTagName, long int& num, long
 
 bool MetaEngine::setExifTagLong(const char* exifTagName, long val) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         d->exifMetadata()[exifTagName] = static_cast<int32_t>(val);     // krazy:exclude=typedefs
@@ -420,8 +398,6 @@ bool MetaEngine::setExifTagLong(const char* exifTagName, long val) const
 
 bool MetaEngine::setExifTagRational(const char* exifTagName, long int num, long int den) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         d->exifMetadata()[exifTagName] = Exiv2::Rational(num, den);
@@ -444,8 +420,6 @@ bool MetaEngine::setExifTagData(const char* exifTagName, const QByteArray& data)
     if (data.isEmpty())
         return false;
 
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::DataValue val((Exiv2::byte*)data.data(), data.size());
@@ -544,8 +518,6 @@ bool MetaEngine::setExifTagVariant(const char* exifTagName, const QVariant& val,
 
 QString MetaEngine::createExifUserStringFromValue(const char* exifTagName, const QVariant& val, bool escapeCR)
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::ExifKey key(exifTagName);
@@ -644,8 +616,6 @@ bool MetaEngine::getExifTagLong(const char* exifTagName, long& val) const
 
 bool MetaEngine::getExifTagLong(const char* exifTagName, long& val, int component) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::ExifKey exifKey(exifTagName);
@@ -674,8 +644,6 @@ bool MetaEngine::getExifTagLong(const char* exifTagName, long& val, int componen
 
 QByteArray MetaEngine::getExifTagData(const char* exifTagName) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::ExifKey exifKey(exifTagName);
@@ -707,8 +675,6 @@ QByteArray MetaEngine::getExifTagData(const char* exifTagName) const
 
 QVariant MetaEngine::getExifTagVariant(const char* exifTagName, bool rationalAsListOfInts, bool stringEscapeCR, int component) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::ExifKey exifKey(exifTagName);
@@ -803,8 +769,6 @@ QVariant MetaEngine::getExifTagVariant(const char* exifTagName, bool rationalAsL
 
 QString MetaEngine::getExifTagString(const char* exifTagName, bool escapeCR) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::ExifKey exifKey(exifTagName);
@@ -849,8 +813,6 @@ QString MetaEngine::getExifTagString(const char* exifTagName, bool escapeCR) con
 
 bool MetaEngine::setExifTagString(const char* exifTagName, const QString& value) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         d->exifMetadata()[exifTagName] = std::string(value.toLatin1().constData());
@@ -876,8 +838,6 @@ QImage MetaEngine::getExifThumbnail(bool fixOrientation) const
     if (d->exifMetadata().empty())
        return thumbnail;
 
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::ExifThumbC thumb(d->exifMetadata());
@@ -941,8 +901,6 @@ bool MetaEngine::setExifThumbnail(const QImage& thumbImage) const
         return removeExifThumbnail();
     }
 
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         QByteArray data;
@@ -971,8 +929,6 @@ bool MetaEngine::setTiffThumbnail(const QImage& thumbImage) const
 {
     removeExifThumbnail();
 
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         // Make sure IFD0 is explicitly marked as a main image
@@ -1037,8 +993,6 @@ bool MetaEngine::setTiffThumbnail(const QImage& thumbImage) const
 
 bool MetaEngine::removeExifThumbnail() const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         // Remove all IFD0 subimages.
@@ -1064,8 +1018,6 @@ MetaEngine::MetaDataMap MetaEngine::getExifTagsDataList(const QStringList& exifK
     if (d->exifMetadata().empty())
        return MetaDataMap();
 
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::ExifData exifData = d->exifMetadata();
@@ -1142,8 +1094,6 @@ MetaEngine::MetaDataMap MetaEngine::getExifTagsDataList(const QStringList& exifK
 
 MetaEngine::TagsMap MetaEngine::getStdExifTagsList() const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         QList<const Exiv2::TagInfo*> tags;
@@ -1205,8 +1155,6 @@ MetaEngine::TagsMap MetaEngine::getStdExifTagsList() const
 
 MetaEngine::TagsMap MetaEngine::getMakernoteTagsList() const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         QList<const Exiv2::TagInfo*> tags;
@@ -30,6 +30,7 @@
 
 #include "digikam_debug.h"
 #include "digikam_version.h"
+#include "metaenginecache.h"
 
 namespace Digikam
 {
@@ -94,49 +95,63 @@ bool MetaEngine::load(const QString& filePath)
     d->filePath      = filePath;
     bool hasLoaded   = false;
 
-    QMutexLocker lock(&s_metaEngineMutex);
+    // The file may have been parsed already by another MetaEngine instance.
 
-    try
+    QFileInfo      fileInfo(filePath);
+    MetaEngineData cachedData;
+
+    if (MetaEngineCache::instance()->find(fileInfo, cachedData, d->pixelSize, d->mimeType))
+    {
+        setData(cachedData);
+        hasLoaded = true;
+    }
+    else
     {
-        Exiv2::Image::AutoPtr image;
+        try
+        {
+            Exiv2::Image::AutoPtr image;
 
-        image        = Exiv2::ImageFactory::open((const char*)(QFile::encodeName(filePath)).constData());
+            image        = Exiv2::ImageFactory::open((const char*)(QFile::encodeName(filePath)).constData());
 
-        image->readMetadata();
+            image->readMetadata();
 
-        // Size and mimetype ---------------------------------
+            // Size and mimetype ---------------------------------
 
-        d->pixelSize = QSize(image->pixelWidth(), image->pixelHeight());
-        d->mimeType  = QLatin1String(image->mimeType().c_str());
+            d->pixelSize = QSize(image->pixelWidth(), image->pixelHeight());
+            d->mimeType  = QLatin1String(image->mimeType().c_str());
 
-        // Image comments ---------------------------------
+            // Image comments ---------------------------------
 
-        d->itemComments() = image->comment();
+            d->itemComments() = image->comment();
 
-        // Exif metadata ----------------------------------
+            // Exif metadata ----------------------------------
 
-        d->exifMetadata() = image->exifData();
+            d->exifMetadata() = image->exifData();
 
-        // Iptc metadata ----------------------------------
+            // Iptc metadata ----------------------------------
 
-        d->iptcMetadata() = image->iptcData();
+            d->iptcMetadata() = image->iptcData();
 
 #ifdef _XMP_SUPPORT_
 
-        // Xmp metadata -----------------------------------
-        d->xmpMetadata() = image->xmpData();
+            // Xmp metadata -----------------------------------
+            d->xmpMetadata() = image->xmpData();
 
 #endif // _XMP_SUPPORT_
 
-        hasLoaded = true;
-    }
-    catch( Exiv2::Error& e )
-    {
-        d->printExiv2ExceptionError(QString::fromUtf8("Cannot load metadata from file %1").arg(getFilePath()), e);
-    }
-    catch(...)
-    {
-        qCCritical(DIGIKAM_METAENGINE_LOG) << "Default exception from Exiv2";
+            hasLoaded = true;
+
+            // Only the metadata from the file are shared, not the merged sidecar.
+            MetaEngineCache::instance()->insert(fileInfo, data(), d->pixelSize, d->mimeType);
+        }
+        catch( Exiv2::Error& e )
+        {
+            d->printExiv2ExceptionError(QString::fromUtf8("Cannot load metadata from file %1").arg(getFilePath()), e);
+        }
+        catch(...)
+        {
+            qCCritical(DIGIKAM_METAENGINE_LOG) << "Default exception from Exiv2";
+        }
     }
 
     hasLoaded |= loadFromSidecarAndMerge(filePath);
@@ -156,8 +171,6 @@ bool MetaEngine::loadFromSidecarAndMerge(const QString& filePath)
 
 #ifdef _XMP_SUPPORT_
 
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         if (d->useXMPSidecar4Reading)
@@ -268,6 +281,9 @@ bool MetaEngine::save(const QString& imageFilePath, bool setVersion) const
 
         if (writtenToFile)
         {
+            MetaEngineCache::instance()->remove(regularFilePath);
+            MetaEngineCache::instance()->remove(imageFilePath);
+
             qCDebug(DIGIKAM_METAENGINE_LOG) << "Metadata for file" << finfo.fileName() << "written to file.";
         }
     }
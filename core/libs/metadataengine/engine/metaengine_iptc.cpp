@@ -34,8 +34,6 @@ namespace Digikam
 
 bool MetaEngine::canWriteIptc(const QString& filePath)
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::Image::AutoPtr image = Exiv2::ImageFactory::open((const char*)
@@ -65,8 +63,6 @@ bool MetaEngine::hasIptc() const
 
 bool MetaEngine::clearIptc() const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         d->iptcMetadata().clear();
@@ -86,8 +82,6 @@ bool MetaEngine::clearIptc() const
 
 QByteArray MetaEngine::getIptc(bool addIrbHeader) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         if (!d->iptcMetadata().empty())
@@ -128,8 +122,6 @@ QByteArray MetaEngine::getIptc(bool addIrbHeader) const
 
 bool MetaEngine::setIptc(const QByteArray& data) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         if (!data.isEmpty())
@@ -160,8 +152,6 @@ MetaEngine::MetaDataMap MetaEngine::getIptcTagsDataList(const QStringList& iptcK
     if (d->iptcMetadata().empty())
        return MetaDataMap();
 
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::IptcData iptcData = d->iptcMetadata();
@@ -267,8 +257,6 @@ MetaEngine::MetaDataMap MetaEngine::getIptcTagsDataList(const QStringList& iptcK
 
 QString MetaEngine::getIptcTagTitle(const char* iptcTagName)
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         std::string iptckey(iptcTagName);
@@ -289,8 +277,6 @@ QString MetaEngine::getIptcTagTitle(const char* iptcTagName)
 
 QString MetaEngine::getIptcTagDescription(const char* iptcTagName)
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         std::string iptckey(iptcTagName);
@@ -311,8 +297,6 @@ QString MetaEngine::getIptcTagDescription(const char* iptcTagName)
 
 bool MetaEngine::removeIptcTag(const char* iptcTagName) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::IptcData::iterator it = d->iptcMetadata().begin();
@@ -353,8 +337,6 @@ bool MetaEngine::setIptcTagData(const char* iptcTagName, const QByteArray& data)
     if (data.isEmpty())
         return false;
 
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::DataValue val((Exiv2::byte *)data.data(), data.size());
@@ -375,8 +357,6 @@ bool MetaEngine::setIptcTagData(const char* iptcTagName, const QByteArray& data)
 
 QByteArray MetaEngine::getIptcTagData(const char* iptcTagName) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::IptcKey  iptcKey(iptcTagName);
@@ -407,8 +387,6 @@ QByteArray MetaEngine::getIptcTagData(const char* iptcTagName) const
 
 QString MetaEngine::getIptcTagString(const char* iptcTagName, bool escapeCR) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::IptcKey  iptcKey(iptcTagName);
@@ -442,8 +420,6 @@ QString MetaEngine::getIptcTagString(const char* iptcTagName, bool escapeCR) con
 
 bool MetaEngine::setIptcTagString(const char* iptcTagName, const QString& value) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         d->iptcMetadata()[iptcTagName] = std::string(value.toUtf8().constData());
@@ -466,8 +442,6 @@ bool MetaEngine::setIptcTagString(const char* iptcTagName, const QString& value)
 
 QStringList MetaEngine::getIptcTagsStringList(const char* iptcTagName, bool escapeCR) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         if (!d->iptcMetadata().empty())
@@ -510,8 +484,6 @@ bool MetaEngine::setIptcTagsStringList(const char* iptcTagName, int maxSize,
                                        const QStringList& oldValues,
                                        const QStringList& newValues) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         QStringList oldvals = oldValues;
@@ -574,8 +546,6 @@ bool MetaEngine::setIptcTagsStringList(const char* iptcTagName, int maxSize,
 
 QStringList MetaEngine::getIptcKeywords() const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         if (!d->iptcMetadata().empty())
@@ -613,8 +583,6 @@ QStringList MetaEngine::getIptcKeywords() const
 
 bool MetaEngine::setIptcKeywords(const QStringList& oldKeywords, const QStringList& newKeywords) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         QStringList oldkeys = oldKeywords;
@@ -675,8 +643,6 @@ bool MetaEngine::setIptcKeywords(const QStringList& oldKeywords, const QStringLi
 
 QStringList MetaEngine::getIptcSubjects() const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         if (!d->iptcMetadata().empty())
@@ -712,8 +678,6 @@ QStringList MetaEngine::getIptcSubjects() const
 
 bool MetaEngine::setIptcSubjects(const QStringList& oldSubjects, const QStringList& newSubjects) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         QStringList oldDef = oldSubjects;
@@ -769,8 +733,6 @@ bool MetaEngine::setIptcSubjects(const QStringList& oldSubjects, const QStringLi
 
 QStringList MetaEngine::getIptcSubCategories() const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         if (!d->iptcMetadata().empty())
@@ -806,8 +768,6 @@ QStringList MetaEngine::getIptcSubCategories() const
 
 bool MetaEngine::setIptcSubCategories(const QStringList& oldSubCategories, const QStringList& newSubCategories) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         QStringList oldkeys = oldSubCategories;
@@ -864,8 +824,6 @@ bool MetaEngine::setIptcSubCategories(const QStringList& oldSubCategories, const
 
 MetaEngine::TagsMap MetaEngine::getIptcTagsList() const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         QList<const Exiv2::DataSet*> tags;
@@ -40,8 +40,6 @@ namespace Digikam
 
 bool MetaEngine::setItemProgramId(const QString& program, const QString& version) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         QString software(program);
@@ -103,8 +101,6 @@ bool MetaEngine::setItemProgramId(const QString& program, const QString& version
 
 QSize MetaEngine::getItemDimensions() const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         long width  = -1;
@@ -207,8 +203,6 @@ QSize MetaEngine::getItemDimensions() const
 
 bool MetaEngine::setItemDimensions(const QSize& size) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         // Set Exif values.
@@ -246,8 +240,6 @@ bool MetaEngine::setItemDimensions(const QSize& size) const
 
 MetaEngine::ImageOrientation MetaEngine::getItemOrientation() const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::ExifData exifData(d->exifMetadata());
@@ -349,8 +341,6 @@ MetaEngine::ImageOrientation MetaEngine::getItemOrientation() const
 
 bool MetaEngine::setItemOrientation(ImageOrientation orientation) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         if (orientation < ORIENTATION_UNSPECIFIED || orientation > ORIENTATION_ROT_270)
@@ -503,8 +493,6 @@ MetaEngine::ImageColorWorkSpace MetaEngine::getItemColorWorkSpace() const
 
 bool MetaEngine::setItemColorWorkSpace(ImageColorWorkSpace workspace) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         // Set Exif value.
@@ -535,8 +523,6 @@ bool MetaEngine::setItemColorWorkSpace(ImageColorWorkSpace workspace) const
 
 QDateTime MetaEngine::getItemDateTime() const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         // In first, trying to get Date & time from Exif tags.
@@ -892,8 +878,6 @@ bool MetaEngine::setImageDateTime(const QDateTime& dateTime, bool setDateTimeDig
     if (!dateTime.isValid())
         return false;
 
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         // In first we write date & time into Exif.
@@ -969,8 +953,6 @@ bool MetaEngine::setImageDateTime(const QDateTime& dateTime, bool setDateTimeDig
 
 QDateTime MetaEngine::getDigitizationDateTime(bool fallbackToCreationTime) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         // In first, trying to get Date & time from Exif tags.
@@ -1122,8 +1104,6 @@ QDateTime MetaEngine::getDigitizationDateTime(bool fallbackToCreationTime) const
 
 bool MetaEngine::getItemPreview(QImage& preview) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         // In first we trying to get from Iptc preview tag.
@@ -1154,8 +1134,6 @@ bool MetaEngine::setItemPreview(const QImage& preview) const
         return true;
     }
 
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         QByteArray data;
@@ -62,21 +62,31 @@ extern "C"
 namespace Digikam
 {
 
-/** This mutex is used to protect all Exiv2 API calls when MetaEngine is used with multi-threads.
+/** This mutex is used to protect the parts of Exiv2 which are global to the process:
+ *  the XMP toolkit (see MetaEngine::initializeExiv2()) and the XMP namespaces registry.
+ *  Each MetaEngine instance work on its own data and does not need to lock it: instances
+ *  can be used in parallel from different threads, but one instance must not be shared
+ *  between threads without external synchronization.
  */
 QMutex s_metaEngineMutex(QMutex::Recursive);
 
+/** Set to 1 when the Exiv2 message handler is installed.
+ */
+static QBasicAtomicInt s_exiv2HandlerInstalled = Q_BASIC_ATOMIC_INITIALIZER(0);
+
 MetaEngine::Private::Private()
     : data(new MetaEngineData::Private)
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     writeRawFiles         = false;
     updateFileTimeStamp   = false;
     useXMPSidecar4Reading = false;
     metadataWritingMode   = WRITE_TO_FILE_ONLY;
     loadedFromSidecar     = false;
-    Exiv2::LogMsg::setHandler(MetaEngine::Private::printExiv2MessageHandler);
+
+    if (s_exiv2HandlerInstalled.testAndSetOrdered(0, 1))
+    {
+        Exiv2::LogMsg::setHandler(MetaEngine::Private::printExiv2MessageHandler);
+    }
 }
 
 MetaEngine::Private::~Private()
@@ -125,10 +135,22 @@ Exiv2::XmpData& MetaEngine::Private::xmpMetadata()
 }
 #endif
 
-void MetaEngine::Private::copyPrivateData(const Private* const other)
+void MetaEngine::Private::xmpToolkitLock(void* pLockData, bool lockUnlock)
 {
-    QMutexLocker lock(&s_metaEngineMutex);
+    QMutex* const mutex = static_cast<QMutex*>(pLockData);
 
+    if (lockUnlock)
+    {
+        mutex->lock();
+    }
+    else
+    {
+        mutex->unlock();
+    }
+}
+
+void MetaEngine::Private::copyPrivateData(const Private* const other)
+{
     data                  = other->data;
     filePath              = other->filePath;
     writeRawFiles         = other->writeRawFiles;
@@ -146,8 +168,6 @@ bool MetaEngine::Private::saveToXMPSidecar(const QFileInfo& finfo) const
         return false;
     }
 
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::Image::AutoPtr image;
@@ -233,8 +253,6 @@ bool MetaEngine::Private::saveToFile(const QFileInfo& finfo) const
     bool ret = false;
 */
 
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::Image::AutoPtr image;
@@ -256,8 +274,6 @@ bool MetaEngine::Private::saveToFile(const QFileInfo& finfo) const
 
 bool MetaEngine::Private::saveOperations(const QFileInfo& finfo, Exiv2::Image::AutoPtr image) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::AccessMode mode;
@@ -433,8 +449,6 @@ void MetaEngine::Private::printExiv2MessageHandler(int lvl, const char* msg)
 
 QString MetaEngine::Private::convertCommentValue(const Exiv2::Exifdatum& exifDatum) const
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         std::string comment;
@@ -161,6 +161,11 @@ public:
      */
     static void printExiv2MessageHandler(int lvl, const char* msg);
 
+    /** Lock function given to Exiv2::XmpParser::initialize() to serialize calls to the XMP toolkit.
+     *  'pLockData' is the mutex to use, 'lockUnlock' is true to lock and false to unlock.
+     */
+    static void xmpToolkitLock(void* pLockData, bool lockUnlock);
+
 public:
 
     bool                                        writeRawFiles;
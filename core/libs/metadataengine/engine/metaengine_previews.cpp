@@ -49,8 +49,6 @@ public:
 
     void load(Exiv2::Image::AutoPtr image_)
     {
-        QMutexLocker lock(&s_metaEngineMutex);
-
         try
         {
             image                              = image_;
@@ -88,8 +86,6 @@ public:
 MetaEnginePreviews::MetaEnginePreviews(const QString& filePath)
     : d(new Private)
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::Image::AutoPtr image = Exiv2::ImageFactory::open((const char*)(QFile::encodeName(filePath).constData()));
@@ -108,8 +104,6 @@ MetaEnginePreviews::MetaEnginePreviews(const QString& filePath)
 MetaEnginePreviews::MetaEnginePreviews(const QByteArray& imgData)
     : d(new Private)
 {
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::Image::AutoPtr image = Exiv2::ImageFactory::open((Exiv2::byte*)imgData.data(), imgData.size());
@@ -198,8 +192,6 @@ QByteArray MetaEnginePreviews::data(int index)
     qCDebug(DIGIKAM_METAENGINE_LOG) << "index: "         << index;
     qCDebug(DIGIKAM_METAENGINE_LOG) << "d->properties: " << count();
 
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::PreviewImage image = d->manager->getPreviewImage(d->properties[index]);
@@ -35,7 +35,6 @@ namespace Digikam
 bool MetaEngine::canWriteXmp(const QString& filePath)
 {
 #ifdef _XMP_SUPPORT_
-    QMutexLocker lock(&s_metaEngineMutex);
 
     try
     {
@@ -82,7 +81,6 @@ bool MetaEngine::hasXmp() const
 bool MetaEngine::clearXmp() const
 {
 #ifdef _XMP_SUPPORT_
-    QMutexLocker lock(&s_metaEngineMutex);
 
     try
     {
@@ -106,7 +104,6 @@ bool MetaEngine::clearXmp() const
 QByteArray MetaEngine::getXmp() const
 {
 #ifdef _XMP_SUPPORT_
-    QMutexLocker lock(&s_metaEngineMutex);
 
     try
     {
@@ -138,7 +135,6 @@ QByteArray MetaEngine::getXmp() const
 bool MetaEngine::setXmp(const QByteArray& data) const
 {
 #ifdef _XMP_SUPPORT_
-    QMutexLocker lock(&s_metaEngineMutex);
 
     try
     {
@@ -181,8 +177,6 @@ MetaEngine::MetaDataMap MetaEngine::getXmpTagsDataList(const QStringList& xmpKey
     if (d->xmpMetadata().empty())
        return MetaDataMap();
 
-    QMutexLocker lock(&s_metaEngineMutex);
-
     try
     {
         Exiv2::XmpData xmpData = d->xmpMetadata();
@@ -1041,6 +1035,8 @@ bool MetaEngine::registerXmpNameSpace(const QString& uri, const QString& prefix)
 {
 #ifdef _XMP_SUPPORT_
 
+    QMutexLocker lock(&s_metaEngineMutex);
+
     try
     {
         QString ns = uri;
@@ -1074,6 +1070,8 @@ bool MetaEngine::unregisterXmpNameSpace(const QString& uri)
 {
 #ifdef _XMP_SUPPORT_
 
+    QMutexLocker lock(&s_metaEngineMutex);
+
     try
     {
         QString ns = uri;
@@ -0,0 +1,164 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : shared cache of metadata parsed from files
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "metaenginecache.h"
+
+// Qt includes
+
+#include <QCache>
+#include <QDateTime>
+#include <QMutex>
+#include <QMutexLocker>
+
+namespace Digikam
+{
+
+class Q_DECL_HIDDEN MetaEngineCacheEntry
+{
+public:
+
+    explicit MetaEngineCacheEntry()
+      : fileSize(0)
+    {
+    }
+
+    qint64         fileSize;
+    QDateTime      lastModified;
+
+    MetaEngineData data;
+    QSize          pixelSize;
+    QString        mimeType;
+};
+
+// -----------------------------------------------------------------------------------------------
+
+class Q_DECL_HIDDEN MetaEngineCache::Private
+{
+public:
+
+    explicit Private()
+    {
+        cache.setMaxCost(200);
+    }
+
+    mutable QMutex                        mutex;
+    QCache<QString, MetaEngineCacheEntry> cache;
+};
+
+// -----------------------------------------------------------------------------------------------
+
+class Q_DECL_HIDDEN MetaEngineCacheCreator
+{
+public:
+
+    MetaEngineCache object;
+};
+
+Q_GLOBAL_STATIC(MetaEngineCacheCreator, metaEngineCacheCreator)
+
+// -----------------------------------------------------------------------------------------------
+
+MetaEngineCache* MetaEngineCache::instance()
+{
+    return &metaEngineCacheCreator->object;
+}
+
+MetaEngineCache::MetaEngineCache()
+    : d(new Private)
+{
+}
+
+MetaEngineCache::~MetaEngineCache()
+{
+    delete d;
+}
+
+bool MetaEngineCache::find(const QFileInfo& fileInfo, MetaEngineData& data, QSize& pixelSize, QString& mimeType) const
+{
+    QMutexLocker lock(&d->mutex);
+
+    MetaEngineCacheEntry* const entry = d->cache.object(fileInfo.absoluteFilePath());
+
+    if (!entry)
+    {
+        return false;
+    }
+
+    if (entry->fileSize != fileInfo.size() || entry->lastModified != fileInfo.lastModified())
+    {
+        // The file changed since it was parsed.
+        d->cache.remove(fileInfo.absoluteFilePath());
+        return false;
+    }
+
+    data      = entry->data;
+    pixelSize = entry->pixelSize;
+    mimeType  = entry->mimeType;
+
+    return true;
+}
+
+void MetaEngineCache::insert(const QFileInfo& fileInfo, const MetaEngineData& data, const QSize& pixelSize, const QString& mimeType)
+{
+    QMutexLocker lock(&d->mutex);
+
+    if (d->cache.maxCost() == 0 || !fileInfo.exists())
+    {
+        return;
+    }
+
+    MetaEngineCacheEntry* const entry = new MetaEngineCacheEntry;
+    entry->fileSize                   = fileInfo.size();
+    entry->lastModified               = fileInfo.lastModified();
+    entry->data                       = data;
+    entry->pixelSize                  = pixelSize;
+    entry->mimeType                   = mimeType;
+
+    d->cache.insert(fileInfo.absoluteFilePath(), entry);
+}
+
+void MetaEngineCache::remove(const QString& filePath)
+{
+    QMutexLocker lock(&d->mutex);
+    d->cache.remove(QFileInfo(filePath).absoluteFilePath());
+}
+
+void MetaEngineCache::clear()
+{
+    QMutexLocker lock(&d->mutex);
+    d->cache.clear();
+}
+
+void MetaEngineCache::setMaxEntries(int entries)
+{
+    QMutexLocker lock(&d->mutex);
+    d->cache.setMaxCost(qMax(entries, 0));
+}
+
+int MetaEngineCache::maxEntries() const
+{
+    QMutexLocker lock(&d->mutex);
+    return d->cache.maxCost();
+}
+
+} // namespace Digikam
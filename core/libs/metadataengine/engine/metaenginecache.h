@@ -0,0 +1,98 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : shared cache of metadata parsed from files
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_META_ENGINE_CACHE_H
+#define DIGIKAM_META_ENGINE_CACHE_H
+
+// Qt includes
+
+#include <QString>
+#include <QSize>
+#include <QFileInfo>
+
+// Local includes
+
+#include "digikam_export.h"
+#include "metaengine_data.h"
+
+namespace Digikam
+{
+
+/**
+ * A bounded cache of the metadata parsed by Exiv2 from image files, shared by all
+ * MetaEngine instances. The same file is read by the scanner, the thumbnail and preview
+ * loaders and the DImg loaders, this cache avoids to parse it again each time.
+ *
+ * An entry is only valid for the size and the modification time of the file when it was
+ * parsed. Entries must be removed when a file is known to be changed.
+ * Metadata from XMP sidecars are not cached. All methods are thread-safe.
+ */
+class DIGIKAM_EXPORT MetaEngineCache
+{
+public:
+
+    static MetaEngineCache* instance();
+
+    /**
+     * Look for the metadata parsed from the file. Return true and fill data, pixelSize and
+     * mimeType if an entry exists with the same file size and modification time.
+     */
+    bool find(const QFileInfo& fileInfo, MetaEngineData& data, QSize& pixelSize, QString& mimeType) const;
+
+    /**
+     * Store the metadata parsed from the file. fileInfo must be taken before parsing.
+     */
+    void insert(const QFileInfo& fileInfo, const MetaEngineData& data, const QSize& pixelSize, const QString& mimeType);
+
+    /**
+     * Remove the entry for a file, if any. Call this method when the file changed.
+     */
+    void remove(const QString& filePath);
+
+    /**
+     * Remove all entries.
+     */
+    void clear();
+
+    /**
+     * Manage the maximum number of files in the cache. Zero disables the cache.
+     */
+    void setMaxEntries(int entries);
+    int  maxEntries() const;
+
+private:
+
+    explicit MetaEngineCache();
+    ~MetaEngineCache();
+
+private:
+
+    class Private;
+    Private* const d;
+
+    friend class MetaEngineCacheCreator;
+};
+
+} // namespace Digikam
+
+#endif // DIGIKAM_META_ENGINE_CACHE_H
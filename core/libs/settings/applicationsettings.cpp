@@ -40,6 +40,7 @@
 #include "itemfiltersettings.h"
 #include "itemsortsettings.h"
 #include "mimefilter.h"
+#include "thumbnailloadthread.h"
 #include "thumbnailsize.h"
 #include "thememanager.h"
 
@@ -224,6 +225,7 @@ void ApplicationSettings::readSettings()
     d->previewSettings.convertToEightBit = group.readEntry(d->configPreviewConvertToEightBitEntry,     true);
     d->previewSettings.zoomOrgSize       = group.readEntry(d->configPreviewZoomOrgSizeEntry,           true);
     d->previewShowIcons                  = group.readEntry(d->configPreviewShowIconsEntry,             true);
+    d->videoSmartThumbnails              = group.readEntry(d->configVideoSmartThumbnailsEntry,         false);
     d->showThumbbar                      = group.readEntry(d->configShowThumbbarEntry,                 true);
 
     d->showFolderTreeViewItemsCount      = group.readEntry(d->configShowFolderTreeViewItemsCountEntry, false);
@@ -308,6 +310,8 @@ void ApplicationSettings::readSettings()
                                              d->configGroupingOperateOnAll.value(*it), (int)ApplicationSettings::Ask));
     }
 
+    ThumbnailLoadThread::setVideoSmartFrameSelection(d->videoSmartThumbnails);
+
     emit setupChanged();
     emit recurseSettingsChanged();
     emit balooSettingsChanged();
@@ -420,6 +424,7 @@ void ApplicationSettings::saveSettings()
     group.writeEntry(d->configPreviewConvertToEightBitEntry,           d->previewSettings.convertToEightBit);
     group.writeEntry(d->configPreviewZoomOrgSizeEntry,                 d->previewSettings.zoomOrgSize);
     group.writeEntry(d->configPreviewShowIconsEntry,                   d->previewShowIcons);
+    group.writeEntry(d->configVideoSmartThumbnailsEntry,               d->videoSmartThumbnails);
     group.writeEntry(d->configShowThumbbarEntry,                       d->showThumbbar);
     group.writeEntry(d->configShowFolderTreeViewItemsCountEntry,       d->showFolderTreeViewItemsCount);
 
@@ -269,6 +269,9 @@ public:
     void setPreviewShowIcons(bool val);
     bool getPreviewShowIcons() const;
 
+    void setVideoSmartThumbnails(bool val);
+    bool getVideoSmartThumbnails() const;
+
     // -- Mime-Types Settings -------------------------------------------------------
 
     QString getImageFileFilter() const;
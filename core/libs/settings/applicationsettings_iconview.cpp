@@ -29,6 +29,7 @@
 
 #include "applicationsettings.h"
 #include "applicationsettings_p.h"
+#include "thumbnailloadthread.h"
 
 namespace Digikam
 {
@@ -263,4 +264,15 @@ bool ApplicationSettings::getPreviewShowIcons() const
     return d->previewShowIcons;
 }
 
+void ApplicationSettings::setVideoSmartThumbnails(bool val)
+{
+    d->videoSmartThumbnails = val;
+    ThumbnailLoadThread::setVideoSmartFrameSelection(val);
+}
+
+bool ApplicationSettings::getVideoSmartThumbnails() const
+{
+    return d->videoSmartThumbnails;
+}
+
 } // namespace Digikam
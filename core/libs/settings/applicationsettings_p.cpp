@@ -123,6 +123,7 @@ const QString ApplicationSettings::Private::configPreviewRawUseHalfSizeData(QLat
 const QString ApplicationSettings::Private::configPreviewConvertToEightBitEntry(QLatin1String("Preview Convert To Eight Bit"));
 const QString ApplicationSettings::Private::configPreviewZoomOrgSizeEntry(QLatin1String("Preview Zoom Use Original Size"));
 const QString ApplicationSettings::Private::configPreviewShowIconsEntry(QLatin1String("Preview Show Icons"));
+const QString ApplicationSettings::Private::configVideoSmartThumbnailsEntry(QLatin1String("Video Smart Thumbnails"));
 const QString ApplicationSettings::Private::configShowThumbbarEntry(QLatin1String("Show Thumbbar"));
 const QString ApplicationSettings::Private::configShowFolderTreeViewItemsCountEntry(QLatin1String("Show Folder Tree View Items Count"));
 const QString ApplicationSettings::Private::configShowSplashEntry(QLatin1String("Show Splash"));
@@ -223,6 +224,7 @@ ApplicationSettings::Private::Private(ApplicationSettings* const qq)
       tooltipShowAlbumCaption(false),
       tooltipShowAlbumPreview(false),
       previewShowIcons(true),
+      videoSmartThumbnails(false),
       showThumbbar(false),
       showFolderTreeViewItemsCount(false),
       treeThumbnailSize(0),
@@ -356,6 +358,7 @@ void ApplicationSettings::Private::init()
     tooltipShowAlbumPreview              = false;
 
     previewShowIcons                     = true;
+    videoSmartThumbnails                 = false;
     showThumbbar                         = true;
 
     recursiveAlbums                      = false;
@@ -137,6 +137,7 @@ public:
     static const QString configPreviewConvertToEightBitEntry;
     static const QString configPreviewZoomOrgSizeEntry;
     static const QString configPreviewShowIconsEntry;
+    static const QString configVideoSmartThumbnailsEntry;
     static const QString configShowThumbbarEntry;
     static const QString configShowFolderTreeViewItemsCountEntry;
     static const QString configShowSplashEntry;
@@ -237,6 +238,7 @@ public:
     // preview settings
     PreviewSettings                              previewSettings;
     bool                                         previewShowIcons;
+    bool                                         videoSmartThumbnails;
     bool                                         showThumbbar;
 
     bool                                         showFolderTreeViewItemsCount;
@@ -36,6 +36,7 @@
 #include "iccsettings.h"
 #include "kmemoryinfo.h"
 #include "dmetadata.h"
+#include "metaenginecache.h"
 #include "thumbnailsize.h"
 
 namespace Digikam
@@ -325,6 +326,8 @@ QStringList LoadingCache::thumbnailFilePathsInCache() const
 
 void LoadingCache::notifyFileChanged(const QString& filePath, bool notify)
 {
+    MetaEngineCache::instance()->remove(filePath);
+
     QList<QString> keys = d->imageFilePathHash.values(filePath);
 
     foreach (const QString& cacheKey, keys)
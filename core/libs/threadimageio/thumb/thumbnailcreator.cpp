@@ -152,6 +152,11 @@ void ThumbnailCreator::setRemoveAlphaChannel(bool removeAlpha)
     d->removeAlphaChannel = removeAlpha;
 }
 
+void ThumbnailCreator::setVideoSmartFrameSelection(bool smart)
+{
+    d->videoSmartFrameSelection = smart;
+}
+
 void ThumbnailCreator::setLoadingProperties(DImgLoaderObserver* const observer, const DRawDecoding& settings)
 {
     d->observer    = observer;
@@ -399,6 +404,66 @@ void ThumbnailCreator::storeDetailThumbnail(const QString& path, const QRect& de
     store(path, i, detailRect);
 }
 
+void ThumbnailCreator::storeFromPreview(const QString& path, const DImg& preview) const
+{
+    if (preview.isNull())
+    {
+        return;
+    }
+
+    DImg img;
+
+    if (preview.width() > (uint)d->storageSize() || preview.height() > (uint)d->storageSize())
+    {
+        img = preview.smoothScale(d->storageSize(), d->storageSize(), Qt::KeepAspectRatio);
+    }
+    else
+    {
+        img = preview.copy();
+    }
+
+    // Thumbnails are stored with the orientation of the file, as done by createThumbnail().
+
+    int orientation = LoadSaveThread::exifOrientation(preview, path);
+
+    if (LoadSaveThread::wasExifRotated(preview))
+    {
+        img.reverseRotateAndFlip(orientation);
+    }
+
+    QImage qimage = img.copyQImage();
+
+    if (IccSettings::instance()->useManagedPreviews() && !img.getIccProfile().isNull())
+    {
+        IccManager::transformToSRGB(qimage, img.getIccProfile());
+    }
+
+    ThumbnailInfo  info   = makeThumbnailInfo(ThumbnailIdentifier(path), QRect());
+    ThumbnailImage image;
+    image.qimage          = qimage;
+    image.exifOrientation = orientation;
+
+    switch (d->thumbnailStorage)
+    {
+        case ThumbnailDatabase:
+
+            // isInDatabase() sets d->dbIdForReplacement, the existing entry is replaced.
+            isInDatabase(info);
+            storeInDatabase(info, image);
+            break;
+        case FreeDesktopStandard:
+
+            // image is stored rotated
+            if (d->exifRotate)
+            {
+                image.qimage = exifRotate(image.qimage, image.exifOrientation);
+            }
+
+            storeFreedesktop(info, image);
+            break;
+    }
+}
+
 void ThumbnailCreator::store(const QString& path, const QImage& i, const QRect& rect) const
 {
     if (i.isNull())
@@ -594,7 +659,29 @@ ThumbnailImage ThumbnailCreator::createThumbnail(const ThumbnailInfo& info, cons
 
             thumbnailer.addFilter(&videoStrip);
             thumbnailer.setThumbnailSize(d->storageSize());
+            thumbnailer.setKeyFramesOnly(d->videoSmartFrameSelection);
+            thumbnailer.setSmartFrameSelection(d->videoSmartFrameSelection);
+
+            // Reuse the frame selected when the thumbnail was generated before.
+
+            qlonglong framePosition = -1;
+            bool      useDatabase   = d->videoSmartFrameSelection                &&
+                                      (d->thumbnailStorage == ThumbnailDatabase) &&
+                                      ThumbsDbAccess::isInitialized();
+
+            if (useDatabase)
+            {
+                framePosition = ThumbsDbAccess().db()->findVideoFramePosition(path, fileInfo.lastModified());
+                thumbnailer.setFramePosition(framePosition);
+            }
+
             thumbnailer.generateThumbnail(path, qimage);
+
+            if (useDatabase && !qimage.isNull() && framePosition == -1 && thumbnailer.framePosition() >= 0)
+            {
+                ThumbsDbAccess().db()->insertVideoFramePosition(path, fileInfo.lastModified(),
+                                                                thumbnailer.framePosition());
+            }
 #else
             qDebug(DIGIKAM_GENERAL_LOG) << "Cannot load video preview for" << path;
             qDebug(DIGIKAM_GENERAL_LOG) << "Video support is not available";
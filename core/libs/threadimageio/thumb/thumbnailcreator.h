@@ -41,6 +41,7 @@
 namespace Digikam
 {
 
+class DImg;
 class IccProfile;
 class DImgLoaderObserver;
 class DMetadata;
@@ -124,6 +125,14 @@ public:
      */
     void setRemoveAlphaChannel(bool removeAlpha);
 
+    /**
+     * If you enable this property, video thumbnails are taken from the most representative
+     * of the first key frames, instead of the single frame decoded by default.
+     * This decodes up to 25 key frames for each new video thumbnail.
+     * Default value is false.
+     */
+    void setVideoSmartFrameSelection(bool smart);
+
     /**
      * Set a ThumbnailInfoProvider to provide custom ThumbnailInfos
      */
@@ -151,6 +160,14 @@ public:
 
     void storeDetailThumbnail(const QString& path, const QRect& detailRect, const QImage& image) const;
 
+    /**
+     * Store a thumbnail of the given path computed from a preview image already loaded
+     * by the caller, as returned by PreviewLoadThread, replacing an existing thumbnail.
+     * Exif rotation applied to the preview is reverted as needed by the storage method.
+     * Preview should at least have storedSize().
+     */
+    void storeFromPreview(const QString& path, const DImg& preview) const;
+
     /**
      * Returns the last error that occurred.
      * It is valid if load returned a null QImage object.
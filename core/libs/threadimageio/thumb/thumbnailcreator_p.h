@@ -71,6 +71,7 @@ public:
         exifRotate                                = true;
         removeAlphaChannel                        = true;
         onlyLargeThumbnails                       = false;
+        videoSmartFrameSelection                  = false;
 
         // Used internaly as PNG metadata. Do not use i18n.
         digiKamFingerPrint                        = QLatin1String("Digikam Thumbnail Generator");
@@ -84,6 +85,7 @@ public:
     bool                            exifRotate;
     bool                            removeAlphaChannel;
     bool                            onlyLargeThumbnails;
+    bool                            videoSmartFrameSelection;
 
     ThumbnailCreator::StorageMethod thumbnailStorage;
     ThumbnailInfoProvider*          infoProvider;
@@ -79,6 +79,7 @@ public:
 
     explicit ThumbnailLoadThreadStaticPriv()
       : firstThreadCreated(false),
+        videoSmartFrameSelection(false),
         storageMethod(ThumbnailCreator::FreeDesktopStandard),
         provider(0),
         profile(IccProfile::sRGB())
@@ -93,6 +94,7 @@ public:
 public:
 
     bool                            firstThreadCreated;
+    bool                            videoSmartFrameSelection;
 
     ThumbnailCreator::StorageMethod storageMethod;
     ThumbnailInfoProvider*          provider;
@@ -143,6 +145,9 @@ public:
     bool                      hasHighlightingBorder() const;
     int                       pixmapSizeForThumbnailSize(int thumbnailSize) const;
     int                       thumbnailSizeForPixmapSize(int pixmapSize) const;
+
+    /// Remove the thumbnails of the file from the loading cache, before they are stored again or deleted.
+    static void               removeFromLoadingCache(const QString& filePath);
 };
 
 Q_GLOBAL_STATIC(ThumbnailLoadThread, defaultIconViewObject)
@@ -229,6 +234,16 @@ void ThumbnailLoadThread::setDisplayingWidget(QWidget* const widget)
     static_d->profile = IccManager::displayProfile(widget);
 }
 
+void ThumbnailLoadThread::setVideoSmartFrameSelection(bool smart)
+{
+    static_d->videoSmartFrameSelection = smart;
+}
+
+bool ThumbnailLoadThread::videoSmartFrameSelection()
+{
+    return static_d->videoSmartFrameSelection;
+}
+
 void ThumbnailLoadThread::setThumbnailSize(int size, bool forFace)
 {
     d->size = size;
@@ -322,6 +337,18 @@ int ThumbnailLoadThread::Private::thumbnailSizeForPixmapSize(int pixmapSize) con
     return pixmapSize;
 }
 
+void ThumbnailLoadThread::Private::removeFromLoadingCache(const QString& filePath)
+{
+    LoadingCache* const cache = LoadingCache::cache();
+    LoadingCache::CacheLock lock(cache);
+    QStringList possibleKeys  = LoadingDescription::possibleThumbnailCacheKeys(filePath);
+
+    foreach (const QString& cacheKey, possibleKeys)
+    {
+        cache->removeThumbnail(cacheKey);
+    }
+}
+
 // --- Creating loading descriptions ---
 
 LoadingDescription ThumbnailLoadThread::Private::createLoadingDescription(const ThumbnailIdentifier& identifier, int size,
@@ -821,6 +848,13 @@ void ThumbnailLoadThread::storeDetailThumbnail(const QString& filePath, const QR
     d->creator->storeDetailThumbnail(filePath, detailRect, image);
 }
 
+void ThumbnailLoadThread::storeThumbnailFromPreview(const QString& filePath, const DImg& preview)
+{
+    Private::removeFromLoadingCache(filePath);
+
+    d->creator->storeFromPreview(filePath, preview);
+}
+
 int ThumbnailLoadThread::storedSize() const
 {
     return d->creator->storedSize();
@@ -828,17 +862,22 @@ int ThumbnailLoadThread::storedSize() const
 
 void ThumbnailLoadThread::deleteThumbnail(const QString& filePath)
 {
-    {
-        LoadingCache* const cache = LoadingCache::cache();
-        LoadingCache::CacheLock lock(cache);
-        QStringList possibleKeys  = LoadingDescription::possibleThumbnailCacheKeys(filePath);
+    Private::removeFromLoadingCache(filePath);
 
-        foreach (const QString& cacheKey, possibleKeys)
-        {
-            cache->removeThumbnail(cacheKey);
-        }
+    ThumbnailCreator creator(static_d->storageMethod);
+
+    if (static_d->provider)
+    {
+        creator.setThumbnailInfoProvider(static_d->provider);
     }
 
+    creator.deleteThumbnailsFromDisk(filePath);
+}
+
+void ThumbnailLoadThread::storeThumbnail(const QString& filePath, const DImg& preview)
+{
+    Private::removeFromLoadingCache(filePath);
+
     ThumbnailCreator creator(static_d->storageMethod);
 
     if (static_d->provider)
@@ -846,7 +885,9 @@ void ThumbnailLoadThread::deleteThumbnail(const QString& filePath)
         creator.setThumbnailInfoProvider(static_d->provider);
     }
 
-    creator.deleteThumbnailsFromDisk(filePath);
+    creator.setOnlyLargeThumbnails(true);
+    creator.setRemoveAlphaChannel(true);
+    creator.storeFromPreview(filePath, preview);
 }
 
 // --- ThumbnailImageCatcher ---------------------------------------------------------
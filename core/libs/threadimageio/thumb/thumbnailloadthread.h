@@ -76,6 +76,14 @@ public:
      */
     static void setDisplayingWidget(QWidget* const widget);
 
+    /**
+     * Take new video thumbnails from the most representative of the first key frames,
+     * instead of the single frame decoded by default. This is off by default.
+     * (see ThumbnailCreator::setVideoSmartFrameSelection())
+     */
+    static void setVideoSmartFrameSelection(bool smart);
+    static bool videoSmartFrameSelection();
+
     /**
      * Find a thumbnail.
      * If the pixmap is found in the cache, returns true and sets pixmap
@@ -220,6 +228,13 @@ public:
     void storeDetailThumbnail(const QString& filePath, const QRect& detailRect, const QImage& image, bool isFace = false);
     int  storedSize() const;
 
+    /**
+     * Stores a thumbnail computed from a preview image already loaded for another purpose,
+     * replacing the thumbnail stored on disk. Cached instances are removed.
+     * The preview should at least have storedSize().
+     */
+    void storeThumbnailFromPreview(const QString& filePath, const DImg& preview);
+
     /**
      * This is a tool to force regeneration of thumbnails.
      * All thumbnail files for the given file will be removed from disk,
@@ -229,6 +244,14 @@ public:
      */
     static void deleteThumbnail(const QString& filePath);
 
+    /**
+     * Store the thumbnail of the given file created from the preview image, as
+     * storeThumbnailFromPreview() does. This method works independently from the
+     * multithreaded thumbnail loading, for instance to store the thumbnail of a file
+     * from an embedded preview read when the file is written.
+     */
+    static void storeThumbnail(const QString& filePath, const DImg& preview);
+
 Q_SIGNALS:
 
     // See LoadSaveThread for a QImage-based thumbnailLoaded() signal.
@@ -229,6 +229,7 @@ void ThumbnailLoadingTask::setupCreator()
 {
     m_creator->setThumbnailSize(m_loadingDescription.previewParameters.size);
     m_creator->setExifRotate(MetaEngineSettings::instance()->settings().exifRotate);
+    m_creator->setVideoSmartFrameSelection(ThumbnailLoadThread::videoSmartFrameSelection());
     m_creator->setLoadingProperties(this, m_loadingDescription.rawDecodingSettings);
 }
 
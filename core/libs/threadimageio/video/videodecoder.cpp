@@ -32,9 +32,11 @@
 namespace Digikam
 {
 
-VideoDecoder::VideoDecoder(const QString& filename)
+VideoDecoder::VideoDecoder(const QString& filename, bool keyFramesOnly, int scaledSize)
     : d(new Private)
 {
+    d->keyFramesOnly = keyFramesOnly;
+    d->scaledSize    = scaledSize;
     initialize(filename);
 }
 
@@ -220,6 +222,58 @@ void VideoDecoder::seek(int timeInSeconds)
     }
 }
 
+void VideoDecoder::seekToPosition(qint64 position)
+{
+    if (!d->allowSeek || position < 0)
+    {
+        return;
+    }
+
+    AVRational msTimeBase = { 1, 1000 };
+    qint64 timestamp      = av_rescale_q(position, msTimeBase, d->pVideoStream->time_base);
+
+    if (av_seek_frame(d->pFormatContext, d->videoStream, timestamp, AVSEEK_FLAG_BACKWARD) < 0)
+    {
+        qDebug(DIGIKAM_GENERAL_LOG) << "Seeking in video failed";
+        return;
+    }
+
+    avcodec_flush_buffers(d->pVideoCodecContext);
+
+    // Decode up to the frame, seeking stops on the previous key frame.
+
+    int attempts = 0;
+
+    while (decodeVideoFrame() && (getFramePosition() < position) && (attempts < 200))
+    {
+        ++attempts;
+    }
+}
+
+qint64 VideoDecoder::getFramePosition() const
+{
+    if (!d->pFrame || !d->pVideoStream)
+    {
+        return -1;
+    }
+
+    qint64 timestamp = d->pFrame->best_effort_timestamp;
+
+    if (timestamp == AV_NOPTS_VALUE)
+    {
+        timestamp = d->pFrame->pts;
+    }
+
+    if (timestamp == AV_NOPTS_VALUE)
+    {
+        return -1;
+    }
+
+    AVRational msTimeBase = { 1, 1000 };
+
+    return av_rescale_q(timestamp, d->pVideoStream->time_base, msTimeBase);
+}
+
 bool VideoDecoder::decodeVideoFrame() const
 {
     bool frameFinished = false;
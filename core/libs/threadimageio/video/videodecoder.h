@@ -40,7 +40,12 @@ class VideoDecoder
 {
 public:
 
-    explicit VideoDecoder(const QString& filename);
+    /**
+     * With keyFramesOnly, only the key frames are decoded, the other frames are skipped.
+     * If scaledSize is set, the frames are decoded at a reduced resolution, still larger
+     * than this size, when the codec supports it.
+     */
+    explicit VideoDecoder(const QString& filename, bool keyFramesOnly = false, int scaledSize = 0);
     ~VideoDecoder();
 
 public:
@@ -52,6 +57,17 @@ public:
     bool    getInitialized() const;
 
     void seek(int timeInSeconds);
+
+    /**
+     * Seek to the frame at position in milliseconds, as returned by getFramePosition().
+     */
+    void seekToPosition(qint64 position);
+
+    /**
+     * Return the position in milliseconds of the last decoded frame, or -1 if unknown.
+     */
+    qint64 getFramePosition() const;
+
     bool decodeVideoFrame()  const;
     void getScaledVideoFrame(int scaledSize,
                              bool maintainAspectRatio,
@@ -44,6 +44,8 @@ VideoDecoder::Private::Private()
     pPacket               = 0;
     allowSeek             = true;
     initialized           = false;
+    keyFramesOnly         = false;
+    scaledSize            = 0;
     bufferSinkContext     = 0;
     bufferSourceContext   = 0;
     filterGraph           = 0;
@@ -102,6 +104,29 @@ bool VideoDecoder::Private::initializeVideo()
     pVideoCodecContext = avcodec_alloc_context3(pVideoCodec);
     avcodec_parameters_to_context(pVideoCodecContext, pVideoCodecParameters);
 
+    if (keyFramesOnly)
+    {
+        // The codec drops all non intra frames without to decode them.
+        pVideoCodecContext->skip_frame = AVDISCARD_NONKEY;
+    }
+
+    if (scaledSize > 0)
+    {
+        // Use the highest reduced resolution supported by the codec which is still larger
+        // than the requested size. This is done in software, whatever the hardware.
+
+        int lowres = 0;
+
+        while ((lowres < pVideoCodec->max_lowres) &&
+               ((pVideoCodecParameters->width  >> (lowres + 1)) >= scaledSize) &&
+               ((pVideoCodecParameters->height >> (lowres + 1)) >= scaledSize))
+        {
+            ++lowres;
+        }
+
+        pVideoCodecContext->lowres = lowres;
+    }
+
     if (avcodec_open2(pVideoCodecContext, pVideoCodec, 0) < 0)
     {
         qDebug(DIGIKAM_GENERAL_LOG) << "Could not open video codec";
@@ -63,6 +63,8 @@ public:
     AVPacket*          pPacket;
     bool               allowSeek;
     bool               initialized;
+    bool               keyFramesOnly;
+    int                scaledSize;
     AVFilterContext*   bufferSinkContext;
     AVFilterContext*   bufferSourceContext;
     AVFilterGraph*     filterGraph;
@@ -85,6 +85,9 @@ public:
         workAroundIssues    = false;
         maintainAspectRatio = true;
         smartFrameSelection = false;
+        keyFramesOnly       = false;
+        seekPosition        = -1;
+        framePosition       = -1;
     }
 
     void generateHistogram(const VideoFrame& videoFrame, Histogram<int>& histogram);
@@ -99,6 +102,9 @@ public:
     bool                      workAroundIssues;
     bool                      maintainAspectRatio;
     bool                      smartFrameSelection;
+    bool                      keyFramesOnly;
+    qint64                    seekPosition;
+    qint64                    framePosition;
     QString                   seekTime;
     QVector<VideoStripFilter*> filters;
 
@@ -158,6 +164,21 @@ void VideoThumbnailer::setSmartFrameSelection(bool enabled)
     d->smartFrameSelection = enabled;
 }
 
+void VideoThumbnailer::setKeyFramesOnly(bool enabled)
+{
+    d->keyFramesOnly = enabled;
+}
+
+void VideoThumbnailer::setFramePosition(qint64 position)
+{
+    d->seekPosition = position;
+}
+
+qint64 VideoThumbnailer::framePosition() const
+{
+    return d->framePosition;
+}
+
 int VideoThumbnailer::timeToSeconds(const QString& time) const
 {
     return QTime::fromString(time, QLatin1String("hh:mm:ss")).secsTo(QTime(0, 0, 0));
@@ -167,7 +188,8 @@ void VideoThumbnailer::generateThumbnail(const QString& videoFile,
                                          VideoThumbWriter& imageWriter,
                                          QImage &image)
 {
-    VideoDecoder movieDecoder(videoFile);
+    VideoDecoder movieDecoder(videoFile, d->keyFramesOnly, d->keyFramesOnly ? d->thumbnailSize : 0);
+    d->framePosition = -1;
 
     if (movieDecoder.getInitialized())
     {
@@ -177,23 +199,34 @@ void VideoThumbnailer::generateThumbnail(const QString& videoFile,
             return;
         }
 
-        if ((!d->workAroundIssues) || (movieDecoder.getCodec() != QLatin1String("h264")))
-        {
-            // workaround for bug in older ffmpeg (100% cpu usage when seeking in h264 files)
-            int secondToSeekTo = d->seekTime.isEmpty() ? movieDecoder.getDuration() * d->seekPercentage / 100
-                                                       : timeToSeconds(d->seekTime);
-            movieDecoder.seek(secondToSeekTo);
-        }
-
         VideoFrame videoFrame;
 
-        if (d->smartFrameSelection)
+        if (d->seekPosition >= 0)
         {
-            generateSmartThumbnail(movieDecoder, videoFrame);
+            // The frame was already selected for a previous thumbnail.
+            movieDecoder.seekToPosition(d->seekPosition);
+            movieDecoder.getScaledVideoFrame(d->thumbnailSize, d->maintainAspectRatio, videoFrame);
+            d->framePosition = movieDecoder.getFramePosition();
         }
         else
         {
-            movieDecoder.getScaledVideoFrame(d->thumbnailSize, d->maintainAspectRatio, videoFrame);
+            if ((!d->workAroundIssues) || (movieDecoder.getCodec() != QLatin1String("h264")))
+            {
+                // workaround for bug in older ffmpeg (100% cpu usage when seeking in h264 files)
+                int secondToSeekTo = d->seekTime.isEmpty() ? movieDecoder.getDuration() * d->seekPercentage / 100
+                                                           : timeToSeconds(d->seekTime);
+                movieDecoder.seek(secondToSeekTo);
+            }
+
+            if (d->smartFrameSelection)
+            {
+                generateSmartThumbnail(movieDecoder, videoFrame, d->framePosition);
+            }
+            else
+            {
+                movieDecoder.getScaledVideoFrame(d->thumbnailSize, d->maintainAspectRatio, videoFrame);
+                d->framePosition = movieDecoder.getFramePosition();
+            }
         }
 
         applyFilters(videoFrame);
@@ -202,15 +235,18 @@ void VideoThumbnailer::generateThumbnail(const QString& videoFile,
 }
 
 void VideoThumbnailer::generateSmartThumbnail(VideoDecoder& movieDecoder,
-                                              VideoFrame& videoFrame)
+                                              VideoFrame& videoFrame,
+                                              qint64& position)
 {
     vector<VideoFrame> videoFrames(d->SMART_FRAME_ATTEMPTS);
     vector<Private::Histogram<int> > histograms(d->SMART_FRAME_ATTEMPTS);
+    vector<qint64> positions(d->SMART_FRAME_ATTEMPTS);
 
     for (int i = 0 ; i < d->SMART_FRAME_ATTEMPTS ; ++i)
     {
         movieDecoder.decodeVideoFrame();
         movieDecoder.getScaledVideoFrame(d->thumbnailSize, d->maintainAspectRatio, videoFrames[i]);
+        positions[i] = movieDecoder.getFramePosition();
         d->generateHistogram(videoFrames[i], histograms[i]);
     }
 
@@ -219,6 +255,7 @@ void VideoThumbnailer::generateSmartThumbnail(VideoDecoder& movieDecoder,
     Q_ASSERT(bestFrame != -1);
 
     videoFrame = videoFrames[bestFrame];
+    position   = positions[bestFrame];
 }
 
 void VideoThumbnailer::generateThumbnail(const QString& videoFile,
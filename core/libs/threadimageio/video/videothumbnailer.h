@@ -63,6 +63,25 @@ public:
     void setWorkAroundIssues(bool workAround);
     void setMaintainAspectRatio(bool enabled);
     void setSmartFrameSelection(bool enabled);
+
+    /**
+     * Only decode the key frames, at a reduced resolution if the codec supports it.
+     * With smart frame selection, the candidates are the next key frames.
+     */
+    void setKeyFramesOnly(bool enabled);
+
+    /**
+     * Use the frame at this position in milliseconds, as returned by framePosition()
+     * for a previous thumbnail. The seek percentage and the smart frame selection are
+     * not used in this case. Set -1 to disable.
+     */
+    void setFramePosition(qint64 position);
+
+    /**
+     * Return the position in milliseconds of the frame used for the last generated
+     * thumbnail, or -1 if unknown.
+     */
+    qint64 framePosition() const;
     void addFilter(VideoStripFilter* const filter);
     void removeFilter(VideoStripFilter* const filter);
     void clearFilters();
@@ -70,7 +89,7 @@ public:
 private:
 
     void generateThumbnail(const QString& videoFile, VideoThumbWriter& imageWriter, QImage& image);
-    void generateSmartThumbnail(VideoDecoder& movieDecoder, VideoFrame& videoFrame);
+    void generateSmartThumbnail(VideoDecoder& movieDecoder, VideoFrame& videoFrame, qint64& position);
 
     void applyFilters(VideoFrame& frameData);
     int  timeToSeconds(const QString& time) const;
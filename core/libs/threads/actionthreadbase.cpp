@@ -65,10 +65,83 @@ public:
 
     explicit Private()
     {
-        running = false;
-        pool    = 0;
+        running       = false;
+        pool          = 0;
+        ownPool       = 0;
+        maxJobs       = 1;
+        useGlobalPool = false;
+        runningJobs   = 0;
     }
 
+    /** Run a job in the pool and count it while it runs, so that the jobs of this
+     *  thread can be waited for, even in the global pool shared with other code.
+     */
+    class Q_DECL_HIDDEN JobRunner : public QRunnable
+    {
+    public:
+
+        JobRunner(ActionJob* const job, Private* const d)
+            : m_job(job),
+              m_d(d)
+        {
+            setAutoDelete(true);
+        }
+
+        void run()
+        {
+            static_cast<QRunnable*>(m_job)->run();
+            m_d->jobStopped();
+        }
+
+    private:
+
+        ActionJob* const m_job;
+        Private* const   m_d;
+    };
+
+    void startJob(ActionJob* const job, int priority)
+    {
+        {
+            QMutexLocker lock(&runningMutex);
+            ++runningJobs;
+        }
+
+        pool->start(new JobRunner(job, this), priority);
+    }
+
+    void jobStopped()
+    {
+        QMutexLocker lock(&runningMutex);
+
+        --runningJobs;
+        condVarRunning.wakeAll();
+    }
+
+    void waitForRunningJobs()
+    {
+        QMutexLocker lock(&runningMutex);
+
+        while (runningJobs > 0)
+        {
+            condVarRunning.wait(&runningMutex);
+        }
+    }
+
+    /** Return the number of jobs which can be started now.
+     */
+    int availableJobSlots() const
+    {
+        if (!useGlobalPool)
+        {
+            // The private pool queues the jobs itself.
+            return todo.count();
+        }
+
+        return qMax(0, maxJobs - pending.count());
+    }
+
+public:
+
     volatile bool       running;
 
     QWaitCondition      condVarJobs;
@@ -79,13 +152,21 @@ public:
     ActionJobCollection processed;
 
     QThreadPool*        pool;
+    QThreadPool*        ownPool;
+    int                 maxJobs;
+    bool                useGlobalPool;
+
+    QMutex              runningMutex;
+    QWaitCondition      condVarRunning;
+    int                 runningJobs;
 };
 
 ActionThreadBase::ActionThreadBase(QObject* const parent)
     : QThread(parent),
       d(new Private)
 {
-    d->pool = new QThreadPool(this);
+    d->ownPool = new QThreadPool(this);
+    d->pool    = d->ownPool;
 
     defaultMaximumNumberOfThreads();
 }
@@ -97,8 +178,9 @@ ActionThreadBase::~ActionThreadBase()
     // wait for the thread to finish
     wait();
 
-    //wait for the jobs to finish
-    d->pool->waitForDone();
+    // Wait for the jobs of this thread to finish. Do not wait for the pool to be done,
+    // the global pool can run tasks which are not related to this thread.
+    d->waitForRunningJobs();
 
     // Cleanup all jobs from memory
     foreach(ActionJob* const job, d->todo.keys())
@@ -121,13 +203,26 @@ ActionThreadBase::~ActionThreadBase()
 
 void ActionThreadBase::setMaximumNumberOfThreads(int n)
 {
-    d->pool->setMaxThreadCount(n);
+    QMutexLocker lock(&d->mutex);
+
+    d->maxJobs = qMax(n, 1);
+    d->ownPool->setMaxThreadCount(d->maxJobs);
+    d->condVarJobs.wakeAll();
+
     qCDebug(DIGIKAM_GENERAL_LOG) << "Using " << n << " CPU core to run threads";
 }
 
 int ActionThreadBase::maximumNumberOfThreads() const
 {
-    return d->pool->maxThreadCount();
+    return d->maxJobs;
+}
+
+void ActionThreadBase::setUseGlobalThreadPool(bool b)
+{
+    QMutexLocker lock(&d->mutex);
+
+    d->useGlobalPool = b;
+    d->pool          = b ? QThreadPool::globalInstance() : d->ownPool;
 }
 
 void ActionThreadBase::defaultMaximumNumberOfThreads()
@@ -152,7 +247,7 @@ void ActionThreadBase::slotJobFinished()
     d->processed.insert(job, 0);
     d->pending.remove(job);
 
-    if (isEmpty())
+    if (isEmpty() && d->todo.isEmpty())
     {
         d->running = false;
     }
@@ -209,11 +304,15 @@ void ActionThreadBase::run()
     {
         QMutexLocker lock(&d->mutex);
 
-        if (!d->todo.isEmpty())
+        int freeSlots = d->availableJobSlots();
+
+        if (!d->todo.isEmpty() && freeSlots > 0)
         {
-            qCDebug(DIGIKAM_GENERAL_LOG) << "Action Thread run " << d->todo.count() << " new jobs";
+            qCDebug(DIGIKAM_GENERAL_LOG) << "Action Thread run " << qMin(freeSlots, d->todo.count()) << " new jobs";
 
-            for (ActionJobCollection::iterator it = d->todo.begin() ; it != d->todo.end(); ++it)
+            ActionJobCollection::iterator it = d->todo.begin();
+
+            while (it != d->todo.end() && freeSlots > 0)
             {
                 ActionJob* const job = it.key();
                 int priority         = it.value();
@@ -221,11 +320,12 @@ void ActionThreadBase::run()
                 connect(job, SIGNAL(signalDone()),
                         this, SLOT(slotJobFinished()));
 
-                d->pool->start(job, priority);
+                d->startJob(job, priority);
                 d->pending.insert(job, priority);
-            }
 
-            d->todo.clear();
+                it = d->todo.erase(it);
+                --freeSlots;
+            }
         }
         else
         {
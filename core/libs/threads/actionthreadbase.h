@@ -111,6 +111,15 @@ public:
      */
     void defaultMaximumNumberOfThreads();
 
+    /** Run jobs in the application-wide QThreadPool::globalInstance() instead of a private pool.
+     *  The jobs then share the threads with the multithreaded code started with QtConcurrent,
+     *  as image filters, and a job waiting for a QtConcurrent task not yet started runs it
+     *  itself (work stealing) instead of adding a thread. The maximum number of threads is
+     *  then the maximum number of jobs running at the same time, the global pool is unchanged.
+     *  Call this method before to append jobs.
+     */
+    void setUseGlobalThreadPool(bool b);
+
     /** Cancel processing of current jobs under progress.
      */
     void cancel();
@@ -43,6 +43,7 @@ namespace Digikam
 
 ParallelWorkers::ParallelWorkers()
     : m_currentIndex(0),
+      m_dispatchMode(LeastLoaded),
       m_replacementMetaObject(0),
       m_originalStaticMetacall(0)
 {
@@ -100,6 +101,65 @@ void ParallelWorkers::setPriority(QThread::Priority priority)
     }
 }
 
+void ParallelWorkers::setDispatchMode(DispatchMode mode)
+{
+    m_dispatchMode = mode;
+}
+
+ParallelWorkers::DispatchMode ParallelWorkers::dispatchMode() const
+{
+    return m_dispatchMode;
+}
+
+QList<int> ParallelWorkers::queueDepths() const
+{
+    QList<int> depths;
+
+    foreach (WorkerObject* const object, m_workers)
+    {
+        depths << object->pendingCalls();
+    }
+
+    return depths;
+}
+
+int ParallelWorkers::nextWorker(const QList<WorkerObject*>& workers, int& currentIndex, DispatchMode mode)
+{
+    if (currentIndex >= workers.size())
+    {
+        currentIndex = 0;
+    }
+
+    int index = currentIndex;
+
+    if (mode == LeastLoaded)
+    {
+        // A worker busy with a costly item keeps its queue, the next calls go to the others.
+        int minimum = workers.at(index)->pendingCalls();
+
+        for (int i = 1 ; (i < workers.size()) && (minimum > 0) ; ++i)
+        {
+            int candidate = (currentIndex + i) % workers.size();
+            int pending   = workers.at(candidate)->pendingCalls();
+
+            if (pending < minimum)
+            {
+                minimum = pending;
+                index   = candidate;
+            }
+        }
+    }
+
+    currentIndex = index + 1;
+
+    if (currentIndex == workers.size())
+    {
+        currentIndex = 0;
+    }
+
+    return index;
+}
+
 void ParallelWorkers::add(WorkerObject* const worker)
 {
 /*
@@ -170,9 +230,9 @@ int ParallelWorkers::replacementStaticQtMetacall(QMetaObject::Call _c, int _id,
         // Get the relevant meta method. I'm not quite sure if this is rock solid.
         QMetaMethod method = mobj->method(_id + mobj->methodOffset());
 
-        // Copy the argument data - _a is going to be deleted in our current thread
-        QList<QByteArray> types = method.parameterTypes();
-        QVector<QGenericArgument> args(10);
+        // The argument data are copied by dispatch() - _a is going to be deleted in our current thread
+        QList<QByteArray>       types = method.parameterTypes();
+        QList<QGenericArgument> args;
 
         for (int i = 0 ; i < types.size() ; ++i)
         {
@@ -184,33 +244,17 @@ int ParallelWorkers::replacementStaticQtMetacall(QMetaObject::Call _c, int _id,
                 return _id - properMethods;
             }
 
-            // we use QMetaType to copy the data. _a[0] is reserved for a return parameter.
-            void* const data = QMetaType::create(typeId, _a[i+1]);
-            args[i]          = QGenericArgument(types[i].constData(), data);
+            // _a[0] is reserved for a return parameter.
+            args << QGenericArgument(types[i].constData(), _a[i+1]);
         }
 
         // Find the object to be invoked
-        WorkerObject* const obj = m_workers.at(m_currentIndex);
-
-        if (++m_currentIndex == m_workers.size())
-        {
-            m_currentIndex = 0;
-        }
+        WorkerObject* const obj = m_workers.at(nextWorker(m_workers, m_currentIndex, m_dispatchMode));
 
         obj->schedule();
 
         // Invoke across-thread
-        method.invoke(obj, Qt::QueuedConnection,
-                      args[0],
-                      args[1],
-                      args[2],
-                      args[3],
-                      args[4],
-                      args[5],
-                      args[6],
-                      args[7],
-                      args[8],
-                      args[9]);
+        obj->dispatch(method, args);
 
         return _id - properMethods; // this return is used by replacementQtMetacall
     }
@@ -39,6 +39,16 @@ namespace Digikam
 class DIGIKAM_EXPORT ParallelWorkers
 {
 
+public:
+
+    enum DispatchMode
+    {
+        /// Each slot call goes to the next worker in turn
+        RoundRobin,
+        /// Each slot call goes to the worker with the least calls queued, in turn for equal queues
+        LeastLoaded
+    };
+
 public:
 
     /**
@@ -57,6 +67,16 @@ public:
 
     void setPriority(QThread::Priority priority);
 
+    /// Sets how slot calls are distributed over the workers. Default is LeastLoaded.
+    void         setDispatchMode(DispatchMode mode);
+    DispatchMode dispatchMode() const;
+
+    /**
+     * Returns the number of slot calls queued to each worker, including the call being
+     * processed, in the order the workers were added. See WorkerObject::pendingCalls().
+     */
+    QList<int> queueDepths() const;
+
     /// Returns true if the current number of added workers has reached the optimalWorkerCount()
     bool optimalWorkerCountReached() const;
 
@@ -66,6 +86,12 @@ public:
      */
     static int optimalWorkerCount();
 
+    /**
+     * Returns the index of the worker which will receive the next slot call with the given mode,
+     * and advances currentIndex. The workers are considered in turn, starting with currentIndex.
+     */
+    static int nextWorker(const QList<WorkerObject*>& workers, int& currentIndex, DispatchMode mode);
+
 public:
 
     /// Connects signals outbound from all workers to a given receiver
@@ -102,6 +128,7 @@ protected:
 
     QList<WorkerObject*>   m_workers;
     int                    m_currentIndex;
+    DispatchMode           m_dispatchMode;
     QMetaObject*           m_replacementMetaObject;
 
     StaticMetacallFunction m_originalStaticMetacall;
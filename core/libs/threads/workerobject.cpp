@@ -27,7 +27,10 @@
 
 #include <QCoreApplication>
 #include <QEvent>
+#include <QAtomicInt>
+#include <QMetaType>
 #include <QMutex>
+#include <QVector>
 #include <QThread>
 #include <QWaitCondition>
 
@@ -39,6 +42,52 @@
 namespace Digikam
 {
 
+/**
+ * A slot call queued with WorkerObject::dispatch(). It owns the copies of the arguments,
+ * and counts itself out of the pending calls when it is deleted: after it was processed,
+ * or when it is removed from the event queue.
+ */
+class Q_DECL_HIDDEN DispatchedCallEvent : public QEvent
+{
+public:
+
+    explicit DispatchedCallEvent(const QMetaMethod& method)
+        : QEvent(eventType()),
+          method(method),
+          pendingCalls(0)
+    {
+    }
+
+    ~DispatchedCallEvent()
+    {
+        for (int i = 0 ; i < data.size() ; ++i)
+        {
+            QMetaType::destroy(typeIds.at(i), data.at(i));
+        }
+
+        if (pendingCalls)
+        {
+            pendingCalls->deref();
+        }
+    }
+
+    static QEvent::Type eventType()
+    {
+        static const int type = QEvent::registerEventType();
+        return (QEvent::Type)type;
+    }
+
+public:
+
+    QMetaMethod       method;
+    QList<QByteArray> typeNames;
+    QList<int>        typeIds;
+    QList<void*>      data;
+    QAtomicInt*       pendingCalls;
+};
+
+// -------------------------------------------------------------------------------------------------
+
 class Q_DECL_HIDDEN WorkerObject::Private
 {
 public:
@@ -59,6 +108,7 @@ public:
     WorkerObjectRunnable*        runnable;
     bool                         inDestruction;
     QThread::Priority            priority;
+    QAtomicInt                   pendingCalls;
 };
 
 WorkerObject::WorkerObject()
@@ -70,6 +120,10 @@ WorkerObject::WorkerObject()
 WorkerObject::~WorkerObject()
 {
     shutDown();
+
+    // The queued calls refer to the counter of pending calls.
+    QCoreApplication::removePostedEvents(this, DispatchedCallEvent::eventType());
+
     delete d;
 }
 
@@ -145,6 +199,44 @@ QThread::Priority WorkerObject::priority() const
     return d->priority;
 }
 
+int WorkerObject::pendingCalls() const
+{
+    return d->pendingCalls.load();
+}
+
+bool WorkerObject::dispatch(const QMetaMethod& method, const QList<QGenericArgument>& arguments)
+{
+    DispatchedCallEvent* const call = new DispatchedCallEvent(method);
+
+    foreach (const QGenericArgument& argument, arguments)
+    {
+        if (!argument.name())
+        {
+            break;
+        }
+
+        int typeId = QMetaType::type(argument.name());
+
+        if (!typeId)
+        {
+            qCWarning(DIGIKAM_GENERAL_LOG) << "Unable to handle unregistered datatype" << argument.name() << "Dropping call.";
+            delete call;
+            return false;
+        }
+
+        // The argument data belongs to the caller, the call is processed later in the worker thread.
+        call->typeNames << QByteArray(argument.name());
+        call->typeIds   << typeId;
+        call->data      << QMetaType::create(typeId, argument.data());
+    }
+
+    d->pendingCalls.ref();
+    call->pendingCalls = &d->pendingCalls;
+    QCoreApplication::postEvent(this, call);
+
+    return true;
+}
+
 bool WorkerObject::event(QEvent* e)
 {
     if (e->type() == QEvent::User)
@@ -154,6 +246,31 @@ bool WorkerObject::event(QEvent* e)
         return true;
     }
 
+    if (e->type() == DispatchedCallEvent::eventType())
+    {
+        DispatchedCallEvent* const call = static_cast<DispatchedCallEvent*>(e);
+        QVector<QGenericArgument> args(10);
+
+        for (int i = 0 ; i < call->data.size() ; ++i)
+        {
+            args[i] = QGenericArgument(call->typeNames.at(i).constData(), call->data.at(i));
+        }
+
+        call->method.invoke(this, Qt::DirectConnection,
+                            args[0],
+                            args[1],
+                            args[2],
+                            args[3],
+                            args[4],
+                            args[5],
+                            args[6],
+                            args[7],
+                            args[8],
+                            args[9]);
+
+        return true;
+    }
+
     return QObject::event(e);
 }
 
@@ -232,6 +349,7 @@ void WorkerObject::deactivate(DeactivatingMode mode)
     if (mode == FlushSignals)
     {
         QCoreApplication::removePostedEvents(this, QEvent::MetaCall);
+        QCoreApplication::removePostedEvents(this, DispatchedCallEvent::eventType());
     }
 
     // cannot say that this is thread-safe: thread()->quit();
@@ -26,6 +26,8 @@
 
 // Qt includes
 
+#include <QList>
+#include <QMetaMethod>
 #include <QObject>
 #include <QThread>
 
@@ -95,6 +97,20 @@ public:
     void setPriority(QThread::Priority priority);
     QThread::Priority priority() const;
 
+    /** The number of slot calls queued to this object with dispatch(), and not yet processed.
+     *  The call being processed is included. Slot calls queued by signal connections
+     *  or by QMetaMethod::invoke() are not counted.
+     */
+    int  pendingCalls() const;
+
+    /** Queues a call of the method on this object, with copies of the given arguments.
+     *  The call is counted in pendingCalls() until it has been processed, or removed from
+     *  the queue by deactivate() with FlushSignals.
+     *  Dispatchers such as ParallelWorkers use this instead of a queued QMetaMethod::invoke().
+     *  Returns false if an argument type is not registered with the meta type system.
+     */
+    bool dispatch(const QMetaMethod& method, const QList<QGenericArgument>& arguments);
+
     /** You must normally call schedule() to ensure that the object is active when you send
      *  a signal with work data. Instead, you can use these connect() methods
      *  when connecting your signal to this object, the signal that carries work data.
@@ -0,0 +1,323 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : Test the image relation components of the core database
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "databaserelationstest.h"
+
+// Qt includes
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QPair>
+#include <QSet>
+#include <QTest>
+
+// Local includes
+
+#include "coredb.h"
+#include "coredbaccess.h"
+#include "coredbbackend.h"
+#include "dbengineparameters.h"
+
+using namespace Digikam;
+
+QTEST_MAIN(DatabaseRelationsTest)
+
+typedef QSet<QPair<qlonglong, qlonglong> > RelationSet;
+
+void DatabaseRelationsTest::initTestCase()
+{
+    m_dbFile     = QDir::temp().filePath(QString::fromUtf8("digikam-relationstest-%1.db")
+                                         .arg(QCoreApplication::applicationPid()));
+    m_imageCount = 0;
+
+    DbEngineParameters params(QLatin1String("QSQLITE"), m_dbFile, QLatin1String("QSQLITE"), m_dbFile);
+    CoreDbAccess::setParameters(params, CoreDbAccess::MainApplication);
+    QVERIFY(CoreDbAccess::checkReadyForUse(0));
+    QVERIFY(QFile(m_dbFile).exists());
+
+    int rootId = CoreDbAccess().db()->addAlbumRoot(AlbumRoot::VolumeHardWired,
+                                                   QLatin1String("volumeid:?path=") + QDir::tempPath(),
+                                                   QLatin1String("/"), QLatin1String("Relations Test"));
+    QVERIFY(rootId != -1);
+
+    m_albumId    = CoreDbAccess().db()->addAlbum(rootId, QLatin1String("/"), QString(),
+                                                 QDate::currentDate(), QString());
+    QVERIFY(m_albumId != -1);
+}
+
+void DatabaseRelationsTest::cleanupTestCase()
+{
+    CoreDbAccess::cleanUpDatabase();
+    QFile(m_dbFile).remove();
+}
+
+QList<qlonglong> DatabaseRelationsTest::addImages(int count)
+{
+    QList<qlonglong> ids;
+
+    for (int i = 0 ; i < count ; ++i)
+    {
+        qlonglong id = CoreDbAccess().db()->addItem(m_albumId,
+                                                    QString::fromUtf8("image%1.jpg").arg(m_imageCount++),
+                                                    DatabaseItem::Visible, DatabaseItem::Image,
+                                                    QDateTime::currentDateTime(), 0, QString());
+        ids << id;
+    }
+
+    return ids;
+}
+
+void DatabaseRelationsTest::verifyClouds(const QList<qlonglong>& ids)
+{
+    // Only DerivedFrom relations are used here: the cloud of all relation types is
+    // the one of the per image walk, which the component based cloud must match.
+
+    foreach (const qlonglong& id, ids)
+    {
+        QList<QPair<qlonglong, qlonglong> > cloud = CoreDbAccess().db()->getRelationCloud(id, DatabaseRelation::DerivedFrom);
+        RelationSet reference                     = CoreDbAccess().db()->getRelationCloud(id).toSet();
+
+        QCOMPARE(cloud.toSet().size(), cloud.size());
+        QCOMPARE(cloud.toSet(), reference);
+    }
+}
+
+int DatabaseRelationsTest::storedComponents(const QList<qlonglong>& ids)
+{
+    int count = 0;
+
+    foreach (const qlonglong& id, ids)
+    {
+        QList<QVariant> values;
+        CoreDbAccess().backend()->execSql(QString::fromUtf8("SELECT component FROM ImageRelationComponents WHERE imageid=?;"),
+                                          id, &values);
+        count += values.size();
+    }
+
+    return count;
+}
+
+void DatabaseRelationsTest::testSingleImage()
+{
+    QList<qlonglong> ids = addImages(2);
+    QVERIFY(!ids.contains(-1));
+
+    QVERIFY(CoreDbAccess().db()->getRelationCloud(ids.at(0), DatabaseRelation::DerivedFrom).isEmpty());
+    QCOMPARE(CoreDbAccess().db()->getImageRelationComponent(ids.at(0)), ids.at(0));
+
+    // Grouping does not change the version components.
+
+    CoreDbAccess().db()->addImageRelation(ids.at(1), ids.at(0), DatabaseRelation::Grouped);
+    QVERIFY(CoreDbAccess().db()->getRelationCloud(ids.at(1), DatabaseRelation::DerivedFrom).isEmpty());
+    QCOMPARE(CoreDbAccess().db()->getImageRelationComponent(ids.at(1)), ids.at(1));
+
+    QCOMPARE(storedComponents(ids), 0);
+}
+
+void DatabaseRelationsTest::testAddRelations()
+{
+    QList<qlonglong> ids = addImages(6);
+    QVERIFY(!ids.contains(-1));
+
+    CoreDbAccess().db()->addImageRelation(ids.at(1), ids.at(0), DatabaseRelation::DerivedFrom);
+    CoreDbAccess().db()->addImageRelation(ids.at(2), ids.at(1), DatabaseRelation::DerivedFrom);
+    verifyClouds(ids.mid(0, 3));
+
+    QCOMPARE(CoreDbAccess().db()->getRelationCloud(ids.at(2), DatabaseRelation::DerivedFrom).size(), 2);
+    QCOMPARE(CoreDbAccess().db()->getImageRelationComponent(ids.at(2)), ids.at(0));
+    QCOMPARE(storedComponents(ids.mid(0, 3)), 3);
+
+    // A new version joins the stored component.
+
+    CoreDbAccess().db()->addImageRelation(ids.at(3), ids.at(2), DatabaseRelation::DerivedFrom);
+    QCOMPARE(storedComponents(ids.mid(0, 4)), 4);
+    QCOMPARE(CoreDbAccess().db()->getImageRelationComponent(ids.at(3)), ids.at(0));
+
+    CoreDbAccess().db()->addImageRelation(ids.at(5), ids.at(4), DatabaseRelation::DerivedFrom);
+    QCOMPARE(CoreDbAccess().db()->getImageRelationComponent(ids.at(5)), ids.at(4));
+
+    // Two stored components are merged.
+
+    CoreDbAccess().db()->addImageRelations(QList<qlonglong>() << ids.at(4),
+                                           QList<qlonglong>() << ids.at(3),
+                                           DatabaseRelation::DerivedFrom);
+    QCOMPARE(CoreDbAccess().db()->getImageRelationComponent(ids.at(5)), ids.at(0));
+    QCOMPARE(CoreDbAccess().db()->getRelationCloud(ids.at(0), DatabaseRelation::DerivedFrom).size(), 5);
+    verifyClouds(ids);
+}
+
+void DatabaseRelationsTest::testRemoveRelations()
+{
+    QList<qlonglong> ids = addImages(5);
+    QVERIFY(!ids.contains(-1));
+
+    for (int i = 1 ; i < ids.size() ; ++i)
+    {
+        CoreDbAccess().db()->addImageRelation(ids.at(i), ids.at(i - 1), DatabaseRelation::DerivedFrom);
+    }
+
+    QCOMPARE(CoreDbAccess().db()->getImageRelationComponent(ids.at(4)), ids.at(0));
+
+    // Removing a relation splits the component.
+
+    CoreDbAccess().db()->removeImageRelation(ids.at(2), ids.at(1), DatabaseRelation::DerivedFrom);
+    verifyClouds(ids);
+    QCOMPARE(CoreDbAccess().db()->getImageRelationComponent(ids.at(4)), ids.at(2));
+    QCOMPARE(CoreDbAccess().db()->getImageRelationComponent(ids.at(1)), ids.at(0));
+    QCOMPARE(CoreDbAccess().db()->getRelationCloud(ids.at(0), DatabaseRelation::DerivedFrom).size(), 1);
+
+    CoreDbAccess().db()->removeAllImageRelationsTo(ids.at(0), DatabaseRelation::DerivedFrom);
+    verifyClouds(ids);
+    QCOMPARE(CoreDbAccess().db()->getImageRelationComponent(ids.at(0)), ids.at(0));
+    QCOMPARE(storedComponents(ids.mid(0, 2)), 0);
+
+    CoreDbAccess().db()->removeAllImageRelationsFrom(ids.at(4), DatabaseRelation::DerivedFrom);
+    verifyClouds(ids);
+    QCOMPARE(CoreDbAccess().db()->getRelationCloud(ids.at(2), DatabaseRelation::DerivedFrom).size(), 1);
+    QVERIFY(CoreDbAccess().db()->getRelationCloud(ids.at(4), DatabaseRelation::DerivedFrom).isEmpty());
+}
+
+void DatabaseRelationsTest::testCopyImageAttributes()
+{
+    QList<qlonglong> ids = addImages(4);
+    QVERIFY(!ids.contains(-1));
+
+    CoreDbAccess().db()->addImageRelation(ids.at(1), ids.at(0), DatabaseRelation::DerivedFrom);
+    CoreDbAccess().db()->addImageRelation(ids.at(2), ids.at(1), DatabaseRelation::DerivedFrom);
+    QCOMPARE(CoreDbAccess().db()->getImageRelationComponent(ids.at(0)), ids.at(0));
+
+    // The copy gets the relations of the source in both directions.
+
+    CoreDbAccess().db()->copyImageAttributes(ids.at(1), ids.at(3));
+    verifyClouds(ids);
+    QCOMPARE(CoreDbAccess().db()->getRelationCloud(ids.at(3), DatabaseRelation::DerivedFrom).size(), 4);
+    QCOMPARE(CoreDbAccess().db()->getImageRelationComponent(ids.at(3)), ids.at(0));
+}
+
+void DatabaseRelationsTest::testDeleteImage()
+{
+    QList<qlonglong> ids = addImages(3);
+    QVERIFY(!ids.contains(-1));
+
+    CoreDbAccess().db()->addImageRelation(ids.at(1), ids.at(0), DatabaseRelation::DerivedFrom);
+    CoreDbAccess().db()->addImageRelation(ids.at(2), ids.at(1), DatabaseRelation::DerivedFrom);
+    QCOMPARE(CoreDbAccess().db()->getRelationCloud(ids.at(0), DatabaseRelation::DerivedFrom).size(), 2);
+
+    // A removed image does not connect the versions anymore.
+
+    CoreDbAccess().db()->removeItems(QList<qlonglong>() << ids.at(1));
+    verifyClouds(QList<qlonglong>() << ids.at(0) << ids.at(2));
+    QVERIFY(CoreDbAccess().db()->getRelationCloud(ids.at(0), DatabaseRelation::DerivedFrom).isEmpty());
+
+    CoreDbAccess().db()->deleteItem(ids.at(1));
+    QCOMPARE(storedComponents(QList<qlonglong>() << ids.at(1)), 0);
+    verifyClouds(QList<qlonglong>() << ids.at(0) << ids.at(2));
+    QVERIFY(CoreDbAccess().db()->getRelationCloud(ids.at(2), DatabaseRelation::DerivedFrom).isEmpty());
+
+    // The remaining images can be related again.
+
+    CoreDbAccess().db()->addImageRelation(ids.at(2), ids.at(0), DatabaseRelation::DerivedFrom);
+    verifyClouds(QList<qlonglong>() << ids.at(0) << ids.at(2));
+    QCOMPARE(CoreDbAccess().db()->getRelationCloud(ids.at(2), DatabaseRelation::DerivedFrom).size(), 1);
+}
+
+void DatabaseRelationsTest::testOutdatedComponents()
+{
+    QList<qlonglong> ids = addImages(5);
+    QVERIFY(!ids.contains(-1));
+
+    CoreDbAccess().db()->addImageRelation(ids.at(1), ids.at(0), DatabaseRelation::DerivedFrom);
+    CoreDbAccess().db()->addImageRelation(ids.at(3), ids.at(2), DatabaseRelation::DerivedFrom);
+    QCOMPARE(CoreDbAccess().db()->getImageRelationComponent(ids.at(1)), ids.at(0));
+    QCOMPARE(CoreDbAccess().db()->getImageRelationComponent(ids.at(3)), ids.at(2));
+
+    // Relations added by an older version, which does not maintain the components.
+
+    CoreDbAccess().backend()->execSql(QString::fromUtf8("INSERT INTO ImageRelations (subject, object, type) VALUES (?, ?, ?);"),
+                                      ids.at(4), ids.at(1), (int)DatabaseRelation::DerivedFrom);
+    CoreDbAccess().backend()->execSql(QString::fromUtf8("INSERT INTO ImageRelations (subject, object, type) VALUES (?, ?, ?);"),
+                                      ids.at(2), ids.at(4), (int)DatabaseRelation::DerivedFrom);
+
+    QCOMPARE(CoreDbAccess().db()->getRelationCloud(ids.at(0), DatabaseRelation::DerivedFrom).size(), 4);
+    QCOMPARE(CoreDbAccess().db()->getImageRelationComponent(ids.at(3)), ids.at(0));
+    verifyClouds(ids);
+
+    // A wrong component id is repaired when the cloud is read.
+
+    CoreDbAccess().backend()->execSql(QString::fromUtf8("UPDATE ImageRelationComponents SET component=? WHERE imageid=?;"),
+                                      ids.at(3), ids.at(1));
+
+    QCOMPARE(CoreDbAccess().db()->getRelationCloud(ids.at(0), DatabaseRelation::DerivedFrom).size(), 4);
+    QCOMPARE(CoreDbAccess().db()->getImageRelationComponent(ids.at(1)), ids.at(0));
+    verifyClouds(ids);
+}
+
+void DatabaseRelationsTest::testRandomRelations()
+{
+    QList<qlonglong> ids = addImages(60);
+    QVERIFY(!ids.contains(-1));
+
+    QList<QPair<qlonglong, qlonglong> > relations;
+    qsrand(4242);
+
+    for (int i = 0 ; i < 400 ; ++i)
+    {
+        int action = qrand() % 10;
+
+        if ((action < 2) && !relations.isEmpty())
+        {
+            QPair<qlonglong, qlonglong> relation = relations.takeAt(qrand() % relations.size());
+            CoreDbAccess().db()->removeImageRelation(relation.first, relation.second, DatabaseRelation::DerivedFrom);
+        }
+        else if (action == 2)
+        {
+            qlonglong src = ids.at(qrand() % ids.size());
+            qlonglong dst = ids.at(qrand() % ids.size());
+
+            if (src != dst)
+            {
+                CoreDbAccess().db()->copyImageAttributes(src, dst);
+            }
+        }
+        else
+        {
+            qlonglong subject = ids.at(qrand() % ids.size());
+            qlonglong object  = ids.at(qrand() % ids.size());
+
+            if (subject != object)
+            {
+                CoreDbAccess().db()->addImageRelation(subject, object, DatabaseRelation::DerivedFrom);
+                relations << qMakePair(subject, object);
+            }
+        }
+
+        if ((i % 40) == 0)
+        {
+            verifyClouds(ids);
+        }
+    }
+
+    verifyClouds(ids);
+}
@@ -0,0 +1,63 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : Test the image relation components of the core database
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_DATABASE_RELATIONS_TEST_H
+#define DIGIKAM_DATABASE_RELATIONS_TEST_H
+
+// Qt includes
+
+#include <QtTest>
+#include <QList>
+#include <QString>
+
+class DatabaseRelationsTest : public QObject
+{
+    Q_OBJECT
+
+private:
+
+    QList<qlonglong> addImages(int count);
+    void             verifyClouds(const QList<qlonglong>& ids);
+    int              storedComponents(const QList<qlonglong>& ids);
+
+private Q_SLOTS:
+
+    void testSingleImage();
+    void testAddRelations();
+    void testRemoveRelations();
+    void testCopyImageAttributes();
+    void testDeleteImage();
+    void testOutdatedComponents();
+    void testRandomRelations();
+
+    void initTestCase();
+    void cleanupTestCase();
+
+private:
+
+    QString m_dbFile;
+    int     m_albumId;
+    int     m_imageCount;
+};
+
+#endif // DIGIKAM_DATABASE_RELATIONS_TEST_H
@@ -0,0 +1,193 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : An unit test to check metadata read and write throughput
+ *               with separated metadata containers processed in parallel.
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "metaenginethroughputtest.h"
+
+// Qt includes
+
+#include <QDirIterator>
+#include <QElapsedTimer>
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
+
+// Local includes
+
+#include "dmetadata.h"
+#include "metaenginecache.h"
+
+QTEST_GUILESS_MAIN(MetaEngineThroughputTest)
+
+/**
+ * Number of times the data files are processed, to get measurable durations.
+ */
+static const int s_iterations = 50;
+
+// -------------------------------------------------------------------------
+
+class MetaEngineWorker : public QRunnable
+{
+public:
+
+    MetaEngineWorker(const QStringList& files, QStringList* const results, int start, int step)
+        : m_files(files),
+          m_results(results),
+          m_start(start),
+          m_step(step)
+    {
+    }
+
+    void run()
+    {
+        // Each worker writes to its own entries of the results list, which is allocated before.
+
+        for (int i = m_start ; i < m_files.count() ; i += m_step)
+        {
+            (*m_results)[i] = processFile(m_files.at(i));
+        }
+    }
+
+    static QString processFile(const QString& filePath)
+    {
+        DMetadata meta;
+
+        if (!meta.load(filePath))
+        {
+            return QString();
+        }
+
+        // Read the info used to populate the core-database.
+
+        QStringList tags;
+        meta.getItemTagsPath(tags);
+
+        QString result = QString::fromLatin1("%1x%2 %3 %4 %5 ")
+                         .arg(meta.getItemDimensions().width())
+                         .arg(meta.getItemDimensions().height())
+                         .arg(meta.getItemDateTime().toString(Qt::ISODate))
+                         .arg(meta.getItemRating())
+                         .arg(tags.join(QLatin1Char(',')));
+
+        // Write in the container only, the XMP packet encoding goes through the XMP toolkit.
+
+        meta.setItemRating(3);
+        meta.setItemColorLabel(2);
+        meta.setItemTagsPath(QStringList() << QLatin1String("digiKam/Unit Tests/Metadata Engine/Throughput"));
+
+        result.append(QString::number(meta.getItemRating()));
+        result.append(QString::number(meta.getXmp().isEmpty()));
+
+        return result;
+    }
+
+private:
+
+    QStringList        m_files;
+    QStringList* const m_results;
+    int                m_start;
+    int                m_step;
+};
+
+// -------------------------------------------------------------------------
+
+void MetaEngineThroughputTest::initTestCase()
+{
+    AbstractUnitTest::initTestCase();
+
+    // Do not share the parsed metadata between iterations, we want to measure the parsing.
+    MetaEngineCache::instance()->setMaxEntries(0);
+}
+
+void MetaEngineThroughputTest::cleanupTestCase()
+{
+    AbstractUnitTest::cleanupTestCase();
+}
+
+QStringList MetaEngineThroughputTest::processFiles(const QStringList& files, int threads, qint64* const elapsed)
+{
+    QStringList results;
+
+    for (int i = 0 ; i < files.count() ; ++i)
+    {
+        results << QString();
+    }
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(threads);
+
+    QElapsedTimer timer;
+    timer.start();
+
+    for (int i = 0 ; i < threads ; ++i)
+    {
+        pool.start(new MetaEngineWorker(files, &results, i, threads));
+    }
+
+    pool.waitForDone();
+    *elapsed = qMax(timer.elapsed(), (qint64)1);
+
+    return results;
+}
+
+void MetaEngineThroughputTest::testParallelReadWrite()
+{
+    QStringList dataFiles;
+    QDirIterator it(m_originalImageFolder, QStringList() << QLatin1String("*.jpg") << QLatin1String("*.JPG"),
+                    QDir::Files);
+
+    while (it.hasNext())
+    {
+        dataFiles << it.next();
+    }
+
+    QVERIFY(!dataFiles.isEmpty());
+
+    QStringList files;
+
+    for (int i = 0 ; i < s_iterations ; ++i)
+    {
+        files << dataFiles;
+    }
+
+    const int threads = qMax(QThread::idealThreadCount(), 2);
+    qint64 serialTime = 0;
+    qint64 parallelTime = 0;
+
+    QStringList serial   = processFiles(files, 1,       &serialTime);
+    QStringList parallel = processFiles(files, threads, &parallelTime);
+
+    QCOMPARE(parallel.count(), serial.count());
+
+    for (int i = 0 ; i < serial.count() ; ++i)
+    {
+        QVERIFY(!serial.at(i).isEmpty());
+        QCOMPARE(parallel.at(i), serial.at(i));
+    }
+
+    qDebug() << endl << "Metadata throughput:"                                                          << endl
+             <<         "    Number of files    :" << files.count()                                     << endl
+             <<         "    1 thread           :" << files.count() * 1000.0 / serialTime   << "files/s" << endl
+             <<         "    " << threads << "threads          :" << files.count() * 1000.0 / parallelTime << "files/s" << endl
+             <<         "    Speed-up           :" << (double)serialTime / parallelTime                 << endl;
+}
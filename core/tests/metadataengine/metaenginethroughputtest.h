@@ -0,0 +1,63 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : An unit test to check metadata read and write throughput
+ *               with separated metadata containers processed in parallel.
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_META_ENGINE_THROUGHPUT_TEST_H
+#define DIGIKAM_META_ENGINE_THROUGHPUT_TEST_H
+
+// Qt includes
+
+#include <QStringList>
+
+// Local includes
+
+#include "abstractunittest.h"
+
+class MetaEngineThroughputTest : public AbstractUnitTest
+{
+    Q_OBJECT
+
+private:
+
+    /**
+     * Process all files with threads workers, and return the result
+     * of each file, in the same order than the files list.
+     */
+    QStringList processFiles(const QStringList& files, int threads, qint64* const elapsed);
+
+private Q_SLOTS:
+
+    void initTestCase();
+    void cleanupTestCase();
+
+    /**
+     * @brief testParallelReadWrite - metadata read and write with separated containers.
+     * Description: load a set of files and change their metadata in memory, first with
+     *              one thread, then with all cores.
+     * Results: The results must be the same whatever the number of threads, and the
+     *          throughput is reported.
+     */
+    void testParallelReadWrite();
+};
+
+#endif // DIGIKAM_META_ENGINE_THROUGHPUT_TEST_H
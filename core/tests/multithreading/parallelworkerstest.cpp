@@ -0,0 +1,185 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : Test the dispatch of slot calls to parallel workers
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "parallelworkerstest.h"
+
+// Qt includes
+
+#include <QMetaMethod>
+#include <QMutexLocker>
+
+// Local includes
+
+#include "parallelworkers.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(ParallelWorkersTest)
+
+TestWorker::~TestWorker()
+{
+    shutDown();
+}
+
+bool TestWorker::dispatchProcess(int value)
+{
+    QMetaMethod method = metaObject()->method(metaObject()->indexOfMethod("process(int)"));
+
+    return dispatch(method, QList<QGenericArgument>() << Q_ARG(int, value));
+}
+
+QList<int> TestWorker::seenPendingCalls()
+{
+    QMutexLocker locker(&m_mutex);
+
+    return m_seenPendingCalls;
+}
+
+void TestWorker::release()
+{
+    m_release.release();
+}
+
+void TestWorker::process(int value)
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_seenPendingCalls << pendingCalls();
+    }
+
+    if (value < 0)
+    {
+        m_release.acquire();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ParallelWorkersTest::testPendingCalls()
+{
+    TestWorker worker;
+
+    // A queued slot call which was not dispatched, as done for settings changes
+    QMetaObject::invokeMethod(&worker, "process", Qt::QueuedConnection, Q_ARG(int, 0));
+
+    QVERIFY(worker.dispatchProcess(1));
+    QVERIFY(worker.dispatchProcess(2));
+    QCOMPARE(worker.pendingCalls(), 2);
+
+    worker.schedule();
+
+    QTRY_COMPARE(worker.seenPendingCalls().size(), 3);
+    QCOMPARE(worker.seenPendingCalls(), QList<int>() << 2 << 2 << 1);
+
+    // A call is counted out when the event is deleted, just after the slot returned
+    QTRY_COMPARE(worker.pendingCalls(), 0);
+}
+
+void ParallelWorkersTest::testPendingCallsAfterFlush()
+{
+    TestWorker worker;
+
+    QVERIFY(worker.dispatchProcess(-1));
+    QVERIFY(worker.dispatchProcess(1));
+    QVERIFY(worker.dispatchProcess(2));
+
+    worker.schedule();
+
+    // The first call is running and blocked, the two others are queued
+    QTRY_COMPARE(worker.seenPendingCalls().size(), 1);
+    QCOMPARE(worker.pendingCalls(), 3);
+
+    // Only the dropped calls are counted out, the running call is still pending
+    worker.deactivate(WorkerObject::FlushSignals);
+    QCOMPARE(worker.pendingCalls(), 1);
+
+    worker.release();
+
+    QTRY_COMPARE(worker.pendingCalls(), 0);
+    QCOMPARE(worker.seenPendingCalls().size(), 1);
+}
+
+void ParallelWorkersTest::testNextWorkerRoundRobin()
+{
+    TestWorker worker1, worker2, worker3;
+    QList<WorkerObject*> workers = QList<WorkerObject*>() << &worker1 << &worker2 << &worker3;
+
+    // Queue depths are not considered
+    QVERIFY(worker1.dispatchProcess(0));
+
+    int currentIndex = 0;
+
+    QCOMPARE(ParallelWorkers::nextWorker(workers, currentIndex, ParallelWorkers::RoundRobin), 0);
+    QCOMPARE(ParallelWorkers::nextWorker(workers, currentIndex, ParallelWorkers::RoundRobin), 1);
+    QCOMPARE(ParallelWorkers::nextWorker(workers, currentIndex, ParallelWorkers::RoundRobin), 2);
+    QCOMPARE(currentIndex, 0);
+    QCOMPARE(ParallelWorkers::nextWorker(workers, currentIndex, ParallelWorkers::RoundRobin), 0);
+
+    // An index left over from a larger set of workers starts again with the first one
+    currentIndex = 5;
+
+    QCOMPARE(ParallelWorkers::nextWorker(workers, currentIndex, ParallelWorkers::RoundRobin), 0);
+    QCOMPARE(currentIndex, 1);
+}
+
+void ParallelWorkersTest::testNextWorkerLeastLoaded()
+{
+    TestWorker worker1, worker2, worker3;
+    QList<WorkerObject*> workers = QList<WorkerObject*>() << &worker1 << &worker2 << &worker3;
+
+    int currentIndex = 0;
+
+    // Equal queues are used in turn
+    QCOMPARE(ParallelWorkers::nextWorker(workers, currentIndex, ParallelWorkers::LeastLoaded), 0);
+    QCOMPARE(ParallelWorkers::nextWorker(workers, currentIndex, ParallelWorkers::LeastLoaded), 1);
+    QCOMPARE(ParallelWorkers::nextWorker(workers, currentIndex, ParallelWorkers::LeastLoaded), 2);
+    QCOMPARE(currentIndex, 0);
+
+    // The workers are not scheduled, so the dispatched calls stay queued: depths are 2, 0, 1
+    QVERIFY(worker1.dispatchProcess(0));
+    QVERIFY(worker1.dispatchProcess(0));
+    QVERIFY(worker3.dispatchProcess(0));
+
+    QCOMPARE(ParallelWorkers::nextWorker(workers, currentIndex, ParallelWorkers::LeastLoaded), 1);
+    QCOMPARE(currentIndex, 2);
+
+    // Depths are 2, 1, 1: the search starts at the current index
+    QVERIFY(worker2.dispatchProcess(0));
+
+    QCOMPARE(ParallelWorkers::nextWorker(workers, currentIndex, ParallelWorkers::LeastLoaded), 2);
+    QCOMPARE(currentIndex, 0);
+
+    // Depths are 2, 1, 2: the search wraps around
+    QVERIFY(worker3.dispatchProcess(0));
+
+    QCOMPARE(ParallelWorkers::nextWorker(workers, currentIndex, ParallelWorkers::LeastLoaded), 1);
+    QCOMPARE(currentIndex, 2);
+
+    // Non-dispatched slot calls do not make a worker look busy
+    QMetaObject::invokeMethod(&worker2, "process", Qt::QueuedConnection, Q_ARG(int, 0));
+    QMetaObject::invokeMethod(&worker2, "process", Qt::QueuedConnection, Q_ARG(int, 0));
+
+    currentIndex = 0;
+
+    QCOMPARE(ParallelWorkers::nextWorker(workers, currentIndex, ParallelWorkers::LeastLoaded), 1);
+}
@@ -0,0 +1,81 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : Test the dispatch of slot calls to parallel workers
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_PARALLEL_WORKERS_TEST_H
+#define DIGIKAM_PARALLEL_WORKERS_TEST_H
+
+// Qt includes
+
+#include <QtTest>
+#include <QList>
+#include <QMutex>
+#include <QSemaphore>
+
+// Local includes
+
+#include "workerobject.h"
+
+class TestWorker : public Digikam::WorkerObject
+{
+    Q_OBJECT
+
+public:
+
+    ~TestWorker();
+
+    /// Dispatch a call of process() to this worker
+    bool dispatchProcess(int value);
+
+    /// The pending calls seen by each call of process(), in processing order
+    QList<int> seenPendingCalls();
+
+    /// Let a call of process() with a negative value return
+    void release();
+
+public Q_SLOTS:
+
+    /// Records the pending calls. With a negative value, blocks until release() is called.
+    void process(int value);
+
+private:
+
+    QMutex     m_mutex;
+    QSemaphore m_release;
+    QList<int> m_seenPendingCalls;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+class ParallelWorkersTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void testPendingCalls();
+    void testPendingCallsAfterFlush();
+    void testNextWorkerRoundRobin();
+    void testNextWorkerLeastLoaded();
+};
+
+#endif // DIGIKAM_PARALLEL_WORKERS_TEST_H
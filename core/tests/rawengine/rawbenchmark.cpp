@@ -0,0 +1,125 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : a command line tool to time RAW decoding and
+ *               RAW post-processing separately
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+// Qt includes
+
+#include <QString>
+#include <QFileInfo>
+#include <QElapsedTimer>
+#include <QThreadPool>
+#include <QDebug>
+
+// Local includes
+
+#include "dimg.h"
+#include "drawdecoder.h"
+#include "drawdecoding.h"
+#include "rawprocessingfilter.h"
+
+using namespace Digikam;
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 3)
+    {
+        qDebug() << "rawbenchmark - time RAW decoding and post-processing";
+        qDebug() << "Usage: <rawfile> [iterations]";
+        return -1;
+    }
+
+    QString   filePath   = QString::fromLatin1(argv[1]);
+    int       iterations = (argc == 3) ? qMax(QString::fromLatin1(argv[2]).toInt(), 1) : 3;
+    QFileInfo input(filePath);
+
+    DRawDecoding settings;
+    settings.rawPrm.sixteenBitsImage = true;
+    settings.rawPrm.RAWQuality       = DRawDecoderSettings::BILINEAR;
+
+    // Post-processing settings applied after the decoding, as in editor and BQM.
+
+    DRawDecoding postSettings(settings);
+    postSettings.wb.temperature      = 5500.0;
+    postSettings.wb.saturation       = 1.2;
+    postSettings.bcg.gamma           = 1.2;
+    postSettings.bcg.contrast        = 1.1;
+
+    qint64 decodeTime  = 0;
+    qint64 loadTime    = 0;
+    qint64 processTime = 0;
+    QSize  size;
+
+    for (int i = 0 ; i < iterations ; ++i)
+    {
+        QElapsedTimer timer;
+
+        // -----------------------------------------------------------
+        // Raw engine decoding only.
+
+        QByteArray  data;
+        int         width, height, rgbmax;
+        DRawDecoder decoder;
+
+        timer.start();
+
+        if (!decoder.decodeRAWImage(filePath, settings.rawPrm, data, width, height, rgbmax))
+        {
+            qDebug() << "rawbenchmark: Decoding RAW image failed. Aborted...";
+            return -1;
+        }
+
+        decodeTime += timer.elapsed();
+        data.clear();
+
+        // -----------------------------------------------------------
+        // Decoding and conversion to DImg through the RAW loader.
+
+        timer.start();
+        DImg image(filePath, 0, settings);
+
+        if (image.isNull())
+        {
+            qDebug() << "rawbenchmark: Loading RAW image failed. Aborted...";
+            return -1;
+        }
+
+        loadTime += timer.elapsed();
+        size      = image.size();
+
+        // -----------------------------------------------------------
+        // Post-processing: white balance, brightness-contrast-gamma and curves.
+
+        timer.start();
+        RawProcessingFilter filter(&image, 0, postSettings);
+        filter.startFilterDirectly();
+        processTime += timer.elapsed();
+    }
+
+    qDebug() << "rawbenchmark:" << input.fileName() << "size" << size << "iterations" << iterations
+             << "threads" << QThreadPool::globalInstance()->maxThreadCount();
+    qDebug() << "--- Decoding:         " << decodeTime  / iterations << "ms";
+    qDebug() << "--- DImg conversion:  " << (loadTime - decodeTime) / iterations << "ms";
+    qDebug() << "--- Post-processing:  " << processTime / iterations << "ms";
+
+    return 0;
+}
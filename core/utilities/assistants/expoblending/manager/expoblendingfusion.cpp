@@ -0,0 +1,711 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : native exposure fusion of bracketed images.
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "expoblendingfusion.h"
+
+// C++ includes
+
+#include <cmath>
+
+// Qt includes
+
+#include <QVector>
+#include <QFuture>
+#include <QThreadPool>
+#include <QtConcurrent>    // krazy:exclude=includes
+
+// Local includes
+
+#include "digikam_debug.h"
+
+namespace Digikam
+{
+
+/**
+ * A floating point image, with values in [0, 1] for the image planes.
+ */
+class Q_DECL_HIDDEN FusionPlane
+{
+public:
+
+    explicit FusionPlane(int w = 0, int h = 0, int c = 1)
+        : width(w),
+          height(h),
+          channels(c),
+          data(w * h * c, 0.0F)
+    {
+    }
+
+    float* line(int y)
+    {
+        return data.data() + y * width * channels;
+    }
+
+    const float* line(int y) const
+    {
+        return data.constData() + y * width * channels;
+    }
+
+public:
+
+    int            width;
+    int            height;
+    int            channels;
+    QVector<float> data;
+};
+
+// -----------------------------------------------------------------------------------------------
+
+class Q_DECL_HIDDEN ExpoBlendingFusion::Private
+{
+public:
+
+    explicit Private()
+      : cancel(0)
+    {
+    }
+
+    bool running() const
+    {
+        return (!cancel || !(*cancel));
+    }
+
+    /**
+     * Split the rows of an image in as many bands than threads.
+     */
+    QList<int> bands(int rows) const;
+    void       waitForTasks(QList<QFuture<void> >& tasks) const;
+
+    // Full image passes, which run the bands in parallel.
+
+    void import(const DImg& src, FusionPlane& dst);
+    void exportTo(const FusionPlane& src, DImg& dst);
+    void weights(const FusionPlane& img, FusionPlane& weight);
+    void normalize(QVector<FusionPlane>& weights);
+    void reduce(const FusionPlane& src, FusionPlane& dst);
+    void expand(const FusionPlane& src, FusionPlane& dst);
+    void combine(const FusionPlane& a, FusionPlane& b, float factor);
+    void blend(const FusionPlane& lap, const FusionPlane& weight, FusionPlane& acc);
+
+    // Band processing.
+
+    void importRows(const DImg* src, FusionPlane* dst, int start, int stop);
+    void exportRows(const FusionPlane* src, DImg* dst, int start, int stop);
+    void weightRows(const FusionPlane* img, FusionPlane* weight, int start, int stop);
+    void normalizeRows(QVector<FusionPlane>* weights, int start, int stop);
+    void reduceRows(const FusionPlane* src, FusionPlane* dst, int start, int stop);
+    void expandRows(const FusionPlane* src, FusionPlane* dst, int start, int stop);
+    void combineRows(const FusionPlane* a, FusionPlane* b, float factor, int start, int stop);
+    void blendRows(const FusionPlane* lap, const FusionPlane* weight, FusionPlane* acc, int start, int stop);
+
+public:
+
+    EnfuseSettings settings;
+    volatile bool* cancel;
+};
+
+QList<int> ExpoBlendingFusion::Private::bands(int rows) const
+{
+    int        nbCore = qMax(QThreadPool::globalInstance()->maxThreadCount(), 1);
+    float      step   = (float)rows / (float)nbCore;
+    QList<int> vals;
+
+    vals << 0;
+
+    for (int i = 1 ; i < nbCore ; ++i)
+    {
+        vals << (int)(i * step);
+    }
+
+    vals << rows;
+
+    return vals;
+}
+
+void ExpoBlendingFusion::Private::waitForTasks(QList<QFuture<void> >& tasks) const
+{
+    foreach (QFuture<void> t, tasks)
+    {
+        t.waitForFinished();
+    }
+}
+
+void ExpoBlendingFusion::Private::import(const DImg& src, FusionPlane& dst)
+{
+    QList<int> vals = bands(dst.height);
+    QList<QFuture<void> > tasks;
+
+    for (int j = 0 ; j < vals.count() - 1 ; ++j)
+    {
+        tasks.append(QtConcurrent::run(this, &Private::importRows, &src, &dst, vals[j], vals[j + 1]));
+    }
+
+    waitForTasks(tasks);
+}
+
+void ExpoBlendingFusion::Private::exportTo(const FusionPlane& src, DImg& dst)
+{
+    QList<int> vals = bands(src.height);
+    QList<QFuture<void> > tasks;
+
+    for (int j = 0 ; j < vals.count() - 1 ; ++j)
+    {
+        tasks.append(QtConcurrent::run(this, &Private::exportRows, &src, &dst, vals[j], vals[j + 1]));
+    }
+
+    waitForTasks(tasks);
+}
+
+void ExpoBlendingFusion::Private::weights(const FusionPlane& img, FusionPlane& weight)
+{
+    QList<int> vals = bands(img.height);
+    QList<QFuture<void> > tasks;
+
+    for (int j = 0 ; j < vals.count() - 1 ; ++j)
+    {
+        tasks.append(QtConcurrent::run(this, &Private::weightRows, &img, &weight, vals[j], vals[j + 1]));
+    }
+
+    waitForTasks(tasks);
+}
+
+void ExpoBlendingFusion::Private::normalize(QVector<FusionPlane>& weights)
+{
+    QList<int> vals = bands(weights.first().height);
+    QList<QFuture<void> > tasks;
+
+    for (int j = 0 ; j < vals.count() - 1 ; ++j)
+    {
+        tasks.append(QtConcurrent::run(this, &Private::normalizeRows, &weights, vals[j], vals[j + 1]));
+    }
+
+    waitForTasks(tasks);
+}
+
+void ExpoBlendingFusion::Private::reduce(const FusionPlane& src, FusionPlane& dst)
+{
+    dst = FusionPlane((src.width + 1) / 2, (src.height + 1) / 2, src.channels);
+
+    QList<int> vals = bands(dst.height);
+    QList<QFuture<void> > tasks;
+
+    for (int j = 0 ; j < vals.count() - 1 ; ++j)
+    {
+        tasks.append(QtConcurrent::run(this, &Private::reduceRows, &src, &dst, vals[j], vals[j + 1]));
+    }
+
+    waitForTasks(tasks);
+}
+
+void ExpoBlendingFusion::Private::expand(const FusionPlane& src, FusionPlane& dst)
+{
+    // dst must be allocated with the size of the upper level.
+
+    QList<int> vals = bands(dst.height);
+    QList<QFuture<void> > tasks;
+
+    for (int j = 0 ; j < vals.count() - 1 ; ++j)
+    {
+        tasks.append(QtConcurrent::run(this, &Private::expandRows, &src, &dst, vals[j], vals[j + 1]));
+    }
+
+    waitForTasks(tasks);
+}
+
+void ExpoBlendingFusion::Private::combine(const FusionPlane& a, FusionPlane& b, float factor)
+{
+    QList<int> vals = bands(b.height);
+    QList<QFuture<void> > tasks;
+
+    for (int j = 0 ; j < vals.count() - 1 ; ++j)
+    {
+        tasks.append(QtConcurrent::run(this, &Private::combineRows, &a, &b, factor, vals[j], vals[j + 1]));
+    }
+
+    waitForTasks(tasks);
+}
+
+void ExpoBlendingFusion::Private::blend(const FusionPlane& lap, const FusionPlane& weight, FusionPlane& acc)
+{
+    QList<int> vals = bands(acc.height);
+    QList<QFuture<void> > tasks;
+
+    for (int j = 0 ; j < vals.count() - 1 ; ++j)
+    {
+        tasks.append(QtConcurrent::run(this, &Private::blendRows, &lap, &weight, &acc, vals[j], vals[j + 1]));
+    }
+
+    waitForTasks(tasks);
+}
+
+void ExpoBlendingFusion::Private::importRows(const DImg* src, FusionPlane* dst, int start, int stop)
+{
+    bool  sixteenBit = src->sixteenBit();
+    float scale      = sixteenBit ? 1.0F / 65535.0F : 1.0F / 255.0F;
+
+    for (int y = start ; y < stop ; ++y)
+    {
+        float* pDst = dst->line(y);
+
+        if (sixteenBit)
+        {
+            const unsigned short* pSrc = reinterpret_cast<const unsigned short*>(src->scanLine(y));
+
+            for (int x = 0 ; x < dst->width ; ++x, pSrc += 4, pDst += 3)
+            {
+                pDst[0] = pSrc[0] * scale;
+                pDst[1] = pSrc[1] * scale;
+                pDst[2] = pSrc[2] * scale;
+            }
+        }
+        else
+        {
+            const uchar* pSrc = src->scanLine(y);
+
+            for (int x = 0 ; x < dst->width ; ++x, pSrc += 4, pDst += 3)
+            {
+                pDst[0] = pSrc[0] * scale;
+                pDst[1] = pSrc[1] * scale;
+                pDst[2] = pSrc[2] * scale;
+            }
+        }
+    }
+}
+
+void ExpoBlendingFusion::Private::exportRows(const FusionPlane* src, DImg* dst, int start, int stop)
+{
+    bool  sixteenBit = dst->sixteenBit();
+    float max        = sixteenBit ? 65535.0F : 255.0F;
+
+    for (int y = start ; y < stop ; ++y)
+    {
+        const float* pSrc = src->line(y);
+
+        if (sixteenBit)
+        {
+            unsigned short* pDst = reinterpret_cast<unsigned short*>(dst->scanLine(y));
+
+            for (int x = 0 ; x < src->width ; ++x, pSrc += 3, pDst += 4)
+            {
+                pDst[0] = (unsigned short)(qBound(0.0F, pSrc[0], 1.0F) * max + 0.5F);
+                pDst[1] = (unsigned short)(qBound(0.0F, pSrc[1], 1.0F) * max + 0.5F);
+                pDst[2] = (unsigned short)(qBound(0.0F, pSrc[2], 1.0F) * max + 0.5F);
+                pDst[3] = 65535;
+            }
+        }
+        else
+        {
+            uchar* pDst = dst->scanLine(y);
+
+            for (int x = 0 ; x < src->width ; ++x, pSrc += 3, pDst += 4)
+            {
+                pDst[0] = (uchar)(qBound(0.0F, pSrc[0], 1.0F) * max + 0.5F);
+                pDst[1] = (uchar)(qBound(0.0F, pSrc[1], 1.0F) * max + 0.5F);
+                pDst[2] = (uchar)(qBound(0.0F, pSrc[2], 1.0F) * max + 0.5F);
+                pDst[3] = 255;
+            }
+        }
+    }
+}
+
+void ExpoBlendingFusion::Private::weightRows(const FusionPlane* img, FusionPlane* weight, int start, int stop)
+{
+    const float wContrast   = settings.contrast;
+    const float wSaturation = settings.saturation;
+    const float wExposure   = settings.exposure;
+    const int   w           = img->width;
+    const int   h           = img->height;
+
+    for (int y = start ; running() && (y < stop) ; ++y)
+    {
+        const float* pUp   = img->line(qMax(y - 1, 0));
+        const float* pCur  = img->line(y);
+        const float* pDown = img->line(qMin(y + 1, h - 1));
+        float*       pDst  = weight->line(y);
+
+        for (int x = 0 ; x < w ; ++x)
+        {
+            const float* p = pCur + x * 3;
+            float wgt      = 1.0F;
+
+            // Contrast: absolute value of the Laplacian filter on the grayscale image.
+
+            if (wContrast != 0.0F)
+            {
+                const int xl   = qMax(x - 1, 0) * 3;
+                const int xr   = qMin(x + 1, w - 1) * 3;
+                float gray     = p[0]         + p[1]             + p[2];
+                float left     = pCur[xl]     + pCur[xl + 1]     + pCur[xl + 2];
+                float right    = pCur[xr]     + pCur[xr + 1]     + pCur[xr + 2];
+                float up       = pUp[x * 3]   + pUp[x * 3 + 1]   + pUp[x * 3 + 2];
+                float down     = pDown[x * 3] + pDown[x * 3 + 1] + pDown[x * 3 + 2];
+                float contrast = fabsf(4.0F * gray - left - right - up - down) / 3.0F;
+                wgt           *= powf(contrast, wContrast);
+            }
+
+            // Saturation: standard deviation of the color channels.
+
+            if (wSaturation != 0.0F)
+            {
+                float mean       = (p[0] + p[1] + p[2]) / 3.0F;
+                float saturation = sqrtf(((p[0] - mean) * (p[0] - mean) +
+                                          (p[1] - mean) * (p[1] - mean) +
+                                          (p[2] - mean) * (p[2] - mean)) / 3.0F);
+                wgt             *= powf(saturation, wSaturation);
+            }
+
+            // Well-exposedness: gaussian curve around 0.5, with sigma = 0.2, for each channel.
+
+            if (wExposure != 0.0F)
+            {
+                float dist     = (p[0] - 0.5F) * (p[0] - 0.5F) +
+                                 (p[1] - 0.5F) * (p[1] - 0.5F) +
+                                 (p[2] - 0.5F) * (p[2] - 0.5F);
+                float exposure = expf(-dist * 12.5F);
+                wgt           *= powf(exposure, wExposure);
+            }
+
+            pDst[x] = wgt + 1.0E-12F;
+        }
+    }
+}
+
+void ExpoBlendingFusion::Private::normalizeRows(QVector<FusionPlane>* weights, int start, int stop)
+{
+    const int count = weights->count();
+    const int width = weights->first().width;
+
+    for (int y = start ; running() && (y < stop) ; ++y)
+    {
+        for (int x = 0 ; x < width ; ++x)
+        {
+            if (settings.hardMask)
+            {
+                // Only the image with the highest weight contributes to the pixel.
+
+                int   best = 0;
+                float max  = -1.0F;
+
+                for (int i = 0 ; i < count ; ++i)
+                {
+                    float& val = (*weights)[i].line(y)[x];
+
+                    if (val > max)
+                    {
+                        max  = val;
+                        best = i;
+                    }
+
+                    val = 0.0F;
+                }
+
+                (*weights)[best].line(y)[x] = 1.0F;
+            }
+            else
+            {
+                float sum = 0.0F;
+
+                for (int i = 0 ; i < count ; ++i)
+                {
+                    sum += (*weights)[i].line(y)[x];
+                }
+
+                for (int i = 0 ; i < count ; ++i)
+                {
+                    (*weights)[i].line(y)[x] /= sum;
+                }
+            }
+        }
+    }
+}
+
+void ExpoBlendingFusion::Private::reduceRows(const FusionPlane* src, FusionPlane* dst, int start, int stop)
+{
+    // Separable 5 taps binomial filter, then decimation.
+
+    static const float kernel[5] = { 1.0F / 16.0F, 4.0F / 16.0F, 6.0F / 16.0F, 4.0F / 16.0F, 1.0F / 16.0F };
+
+    const int      c   = src->channels;
+    QVector<float> tmp(src->width * c);
+
+    for (int y = start ; running() && (y < stop) ; ++y)
+    {
+        tmp.fill(0.0F);
+
+        for (int j = 0 ; j < 5 ; ++j)
+        {
+            const float* pSrc = src->line(qBound(0, 2 * y + j - 2, src->height - 1));
+
+            for (int i = 0 ; i < src->width * c ; ++i)
+            {
+                tmp[i] += kernel[j] * pSrc[i];
+            }
+        }
+
+        float* pDst = dst->line(y);
+
+        for (int x = 0 ; x < dst->width ; ++x)
+        {
+            for (int k = 0 ; k < c ; ++k)
+            {
+                float val = 0.0F;
+
+                for (int i = 0 ; i < 5 ; ++i)
+                {
+                    val += kernel[i] * tmp[qBound(0, 2 * x + i - 2, src->width - 1) * c + k];
+                }
+
+                pDst[x * c + k] = val;
+            }
+        }
+    }
+}
+
+void ExpoBlendingFusion::Private::expandRows(const FusionPlane* src, FusionPlane* dst, int start, int stop)
+{
+    // Upsampling with the same binomial filter: even positions get (1, 6, 1) / 8 from
+    // the 3 nearest source samples, odd positions get (4, 4) / 8 from the 2 nearest ones.
+
+    const int      c = src->channels;
+    QVector<float> tmp(src->width * c);
+
+    for (int y = start ; running() && (y < stop) ; ++y)
+    {
+        const int m = y / 2;
+
+        if (y % 2 == 0)
+        {
+            const float* p0 = src->line(qMax(m - 1, 0));
+            const float* p1 = src->line(qMin(m, src->height - 1));
+            const float* p2 = src->line(qMin(m + 1, src->height - 1));
+
+            for (int i = 0 ; i < src->width * c ; ++i)
+            {
+                tmp[i] = (p0[i] + 6.0F * p1[i] + p2[i]) / 8.0F;
+            }
+        }
+        else
+        {
+            const float* p0 = src->line(qMin(m, src->height - 1));
+            const float* p1 = src->line(qMin(m + 1, src->height - 1));
+
+            for (int i = 0 ; i < src->width * c ; ++i)
+            {
+                tmp[i] = (p0[i] + p1[i]) / 2.0F;
+            }
+        }
+
+        float* pDst = dst->line(y);
+
+        for (int x = 0 ; x < dst->width ; ++x)
+        {
+            const int n = x / 2;
+
+            for (int k = 0 ; k < c ; ++k)
+            {
+                if (x % 2 == 0)
+                {
+                    pDst[x * c + k] = (tmp[qMax(n - 1, 0) * c + k]              +
+                                       6.0F * tmp[qMin(n, src->width - 1) * c + k] +
+                                       tmp[qMin(n + 1, src->width - 1) * c + k]) / 8.0F;
+                }
+                else
+                {
+                    pDst[x * c + k] = (tmp[qMin(n, src->width - 1) * c + k] +
+                                       tmp[qMin(n + 1, src->width - 1) * c + k]) / 2.0F;
+                }
+            }
+        }
+    }
+}
+
+void ExpoBlendingFusion::Private::combineRows(const FusionPlane* a, FusionPlane* b, float factor, int start, int stop)
+{
+    const int size = b->width * b->channels;
+
+    for (int y = start ; running() && (y < stop) ; ++y)
+    {
+        const float* pA = a->line(y);
+        float*       pB = b->line(y);
+
+        for (int i = 0 ; i < size ; ++i)
+        {
+            pB[i] = pA[i] + factor * pB[i];
+        }
+    }
+}
+
+void ExpoBlendingFusion::Private::blendRows(const FusionPlane* lap, const FusionPlane* weight, FusionPlane* acc,
+                                            int start, int stop)
+{
+    for (int y = start ; running() && (y < stop) ; ++y)
+    {
+        const float* pLap = lap->line(y);
+        const float* pW   = weight->line(y);
+        float*       pAcc = acc->line(y);
+
+        for (int x = 0 ; x < acc->width ; ++x, pLap += 3, pAcc += 3)
+        {
+            pAcc[0] += pW[x] * pLap[0];
+            pAcc[1] += pW[x] * pLap[1];
+            pAcc[2] += pW[x] * pLap[2];
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------------------------
+
+ExpoBlendingFusion::ExpoBlendingFusion(const EnfuseSettings& settings)
+    : d(new Private)
+{
+    d->settings = settings;
+}
+
+ExpoBlendingFusion::~ExpoBlendingFusion()
+{
+    delete d;
+}
+
+DImg ExpoBlendingFusion::fuse(const QList<DImg>& images, volatile bool* const cancel)
+{
+    d->cancel = cancel;
+
+    if (images.isEmpty() || images.first().isNull())
+    {
+        return DImg();
+    }
+
+    const int width  = images.first().width();
+    const int height = images.first().height();
+
+    foreach (const DImg& img, images)
+    {
+        if (img.isNull() || (int)img.width() != width || (int)img.height() != height)
+        {
+            qCWarning(DIGIKAM_GENERAL_LOG) << "Exposure fusion: bracketed images do not have the same size";
+            return DImg();
+        }
+    }
+
+    // Levels of the pyramids: the smallest level must keep a few pixels.
+
+    int maxLevels = 1;
+
+    for (int size = qMin(width, height) ; (size > 8) && (maxLevels < 29) ; size = (size + 1) / 2)
+    {
+        ++maxLevels;
+    }
+
+    const int levels = d->settings.autoLevels ? maxLevels : qBound(1, d->settings.levels, maxLevels);
+
+    qCDebug(DIGIKAM_GENERAL_LOG) << "Exposure fusion of" << images.count() << "images"
+                                 << width << "x" << height << "with" << levels << "levels";
+
+    // -- Weight maps ----------------------------------------------------------------
+
+    QVector<FusionPlane> weights(images.count());
+
+    for (int i = 0 ; d->running() && (i < images.count()) ; ++i)
+    {
+        FusionPlane img(width, height, 3);
+        d->import(images.at(i), img);
+
+        weights[i] = FusionPlane(width, height, 1);
+        d->weights(img, weights[i]);
+    }
+
+    if (!d->running())
+    {
+        return DImg();
+    }
+
+    d->normalize(weights);
+
+    // -- Blending of the Laplacian pyramids -----------------------------------------
+    // Images are processed one by one to not keep all pyramids in memory.
+
+    QVector<FusionPlane> result(levels);
+
+    for (int l = 0, w = width, h = height ; l < levels ; ++l, w = (w + 1) / 2, h = (h + 1) / 2)
+    {
+        result[l] = FusionPlane(w, h, 3);
+    }
+
+    for (int i = 0 ; d->running() && (i < images.count()) ; ++i)
+    {
+        FusionPlane gauss(width, height, 3);
+        d->import(images.at(i), gauss);
+
+        FusionPlane weight = weights[i];
+        weights[i]         = FusionPlane();
+
+        for (int l = 0 ; d->running() && (l < levels) ; ++l)
+        {
+            if (l == levels - 1)
+            {
+                // The top level of the Laplacian pyramid is the top level of the Gaussian one.
+
+                d->blend(gauss, weight, result[l]);
+                break;
+            }
+
+            FusionPlane nextGauss;
+            d->reduce(gauss, nextGauss);
+
+            FusionPlane lap(gauss.width, gauss.height, 3);
+            d->expand(nextGauss, lap);
+            d->combine(gauss, lap, -1.0F);
+            d->blend(lap, weight, result[l]);
+
+            FusionPlane nextWeight;
+            d->reduce(weight, nextWeight);
+
+            gauss  = nextGauss;
+            weight = nextWeight;
+        }
+    }
+
+    // -- Collapse of the blended pyramid --------------------------------------------
+
+    for (int l = levels - 2 ; d->running() && (l >= 0) ; --l)
+    {
+        FusionPlane up(result[l].width, result[l].height, 3);
+        d->expand(result[l + 1], up);
+        d->combine(result[l], up, 1.0F);
+        result[l]     = up;
+        result[l + 1] = FusionPlane();
+    }
+
+    if (!d->running())
+    {
+        return DImg();
+    }
+
+    DImg output(width, height, images.first().sixteenBit());
+    d->exportTo(result[0], output);
+    output.setIccProfile(images.first().getIccProfile());
+
+    return output;
+}
+
+} // namespace Digikam
@@ -0,0 +1,75 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : native exposure fusion of bracketed images.
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_EXPO_BLENDING_FUSION_H
+#define DIGIKAM_EXPO_BLENDING_FUSION_H
+
+// Qt includes
+
+#include <QList>
+
+// Local includes
+
+#include "dimg.h"
+#include "enfusesettings.h"
+
+namespace Digikam
+{
+
+/**
+ * In-process exposure fusion, after T. Mertens, J. Kautz and F. Van Reeth,
+ * "Exposure Fusion", Pacific Graphics 2007.
+ *
+ * Each pixel of each image is weighted by its contrast, its saturation and its
+ * well-exposedness, with the weights of EnfuseSettings. The images are blended
+ * through Laplacian pyramids of the images and Gaussian pyramids of the weights.
+ * All passes run on bands of rows over all cores. 8 and 16 bits images are supported.
+ *
+ * The levels, the hard mask and the weights of EnfuseSettings are used, the CIECAM02
+ * blending is not supported and the images are blended in their own color space.
+ */
+class ExpoBlendingFusion
+{
+public:
+
+    explicit ExpoBlendingFusion(const EnfuseSettings& settings);
+    ~ExpoBlendingFusion();
+
+    /**
+     * Fuse the bracketed images, which must have the same size. The result has the depth
+     * and the color profile of the first image. Return a null image if the images cannot be
+     * fused, or if cancel is set to true while processing.
+     */
+    DImg fuse(const QList<DImg>& images, volatile bool* const cancel = 0);
+
+private:
+
+    ExpoBlendingFusion(const ExpoBlendingFusion&); // Disable
+
+    class Private;
+    Private* const d;
+};
+
+} // namespace Digikam
+
+#endif // DIGIKAM_EXPO_BLENDING_FUSION_H
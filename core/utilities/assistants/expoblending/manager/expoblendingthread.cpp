@@ -71,6 +71,7 @@
 #include "dimgloaderobserver.h"
 #include "drawdecoderwidget.h"
 #include "drawdecoding.h"
+#include "expoblendingfusion.h"
 
 namespace Digikam
 {
@@ -85,6 +86,7 @@ public:
       : cancel(false),
         align(false),
         enfuseVersion4x(true),
+        nativeFusion(true),
         rawObserver(0)
     {
     }
@@ -102,6 +104,7 @@ public:
     volatile bool                   cancel;
     bool                            align;
     bool                            enfuseVersion4x;
+    bool                            nativeFusion;
 
     QMutex                          mutex;
     QMutex                          lock;
@@ -185,6 +188,16 @@ void ExpoBlendingThread::setEnfuseVersion(const double version)
     d->enfuseVersion4x = (version >= 4.0);
 }
 
+void ExpoBlendingThread::setNativeFusion(bool native)
+{
+    d->nativeFusion = native;
+}
+
+bool ExpoBlendingThread::nativeFusion() const
+{
+    return d->nativeFusion;
+}
+
 void ExpoBlendingThread::cleanUpResultFiles()
 {
     // Cleanup all tmp files created by Enfuse process.
@@ -393,7 +406,9 @@ void ExpoBlendingThread::run()
                     QUrl    destUrl         = t->outputUrl;
                     EnfuseSettings settings = t->enfuseSettings;
                     settings.outputFormat   = DSaveSettingsWidget::OUTPUT_JPEG;    // JPEG for preview: fast and small.
-                    bool result             = startEnfuse(t->urls, destUrl, settings, t->binaryPath, errors);
+                    bool result             = (d->nativeFusion && !settings.ciecam02) ?
+                                              startNativeFusion(t->urls, destUrl, settings, errors) :
+                                              startEnfuse(t->urls, destUrl, settings, t->binaryPath, errors);
 
                     qCDebug(DIGIKAM_GENERAL_LOG) << "Preview result was: " << result;
 
@@ -439,7 +454,9 @@ void ExpoBlendingThread::run()
 
                     QString errors;
                     QUrl destUrl = t->outputUrl;
-                    bool result  = startEnfuse(t->urls, destUrl, t->enfuseSettings, t->binaryPath, errors);
+                    bool result  = (d->nativeFusion && !t->enfuseSettings.ciecam02) ?
+                                   startNativeFusion(t->urls, destUrl, t->enfuseSettings, errors) :
+                                   startEnfuse(t->urls, destUrl, t->enfuseSettings, t->binaryPath, errors);
 
                     // We will take first image metadata from stack to restore Exif, Iptc, and Xmp.
 
@@ -862,6 +879,70 @@ bool ExpoBlendingThread::startEnfuse(const QList<QUrl>& inUrls, QUrl& outUrl,
     return false;
 }
 
+bool ExpoBlendingThread::startNativeFusion(const QList<QUrl>& inUrls, QUrl& outUrl,
+                                           const EnfuseSettings& settings, QString& errors)
+{
+    QString ext = DSaveSettingsWidget::extensionForFormat(settings.outputFormat);
+
+    outUrl.setPath(outUrl.adjusted(QUrl::RemoveFilename).path() + QLatin1String(".digiKam-expoblending-tmp-") +
+                                                                  QString::number(QDateTime::currentDateTime().toTime_t()) + ext);
+
+    // Images are loaded in parallel, the fusion itself runs on all cores.
+
+    QList<QFuture<DImg> > loading;
+
+    foreach (const QUrl& url, inUrls)
+    {
+        loading.append(QtConcurrent::run(this, &ExpoBlendingThread::loadImage, url));
+    }
+
+    QList<DImg> images;
+
+    for (int i = 0 ; i < loading.count() ; ++i)
+    {
+        DImg img = loading[i].result();
+
+        if (img.isNull())
+        {
+            errors = i18n("Cannot load image %1", inUrls.at(i).toLocalFile());
+            return false;
+        }
+
+        images << img;
+    }
+
+    ExpoBlendingFusion fusion(settings);
+    DImg output = fusion.fuse(images, &d->cancel);
+
+    if (output.isNull())
+    {
+        if (!d->cancel)
+        {
+            errors = i18n("Cannot fuse the bracketed images. They must have the same size.");
+        }
+
+        return false;
+    }
+
+    if (!output.save(outUrl.toLocalFile(), ext.mid(1).toUpper()))
+    {
+        errors = i18n("Cannot save fused image to %1", outUrl.toLocalFile());
+        return false;
+    }
+
+    qCDebug(DIGIKAM_GENERAL_LOG) << "Exposure fusion output url: " << outUrl;
+
+    return true;
+}
+
+DImg ExpoBlendingThread::loadImage(const QUrl& url)
+{
+    DImg img;
+    img.load(url.toLocalFile(), d->rawObserver);
+
+    return img;
+}
+
 QString ExpoBlendingThread::getProcessError(QProcess& proc) const
 {
     QString std = QString::fromLocal8Bit(proc.readAll());
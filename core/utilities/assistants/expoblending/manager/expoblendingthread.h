@@ -31,6 +31,7 @@
 
 // Local includes
 
+#include "dimg.h"
 #include "metaengine.h"
 #include "enfusesettings.h"
 #include "expoblendingactions.h"
@@ -52,6 +53,15 @@ public:
     ~ExpoBlendingThread();
 
     void setEnfuseVersion(const double version);
+
+    /**
+     * Fuse the images in-process with ExpoBlendingFusion instead of the enfuse binary,
+     * for previews and final output. Enabled by default. Settings requiring CIECAM02
+     * blending are still processed by enfuse.
+     */
+    void setNativeFusion(bool native);
+    bool nativeFusion() const;
+
     void setPreProcessingSettings(bool align);
     void loadProcessed(const QUrl& url);
     void identifyFiles(const QList<QUrl>& urlList);
@@ -87,6 +97,11 @@ private:
                         const EnfuseSettings& settings,
                         const QString& enfusePath, QString& errors);
 
+    bool    startNativeFusion(const QList<QUrl>& inUrls, QUrl& outUrl,
+                              const EnfuseSettings& settings, QString& errors);
+
+    DImg    loadImage(const QUrl& url);
+
     QString getProcessError(QProcess& proc) const;
 
     float   getAverageSceneLuminance(const QUrl& url);
@@ -38,6 +38,7 @@
 #include "dbinarysearch.h"
 #include "alignbinary.h"
 #include "enfusebinary.h"
+#include "expoblendingthread.h"
 #include "dlayoutbox.h"
 
 namespace Digikam
@@ -87,6 +88,16 @@ ExpoBlendingIntroPage::ExpoBlendingIntroPage(ExpoBlendingManager* const mngr, QW
     d->binariesWidget->addBinary(d->mngr->alignBinary());
     d->binariesWidget->addBinary(d->mngr->enfuseBinary());
 
+    if (d->mngr->thread()->nativeFusion())
+    {
+        QLabel* const optionalLabel = new QLabel(binaryBox);
+        optionalLabel->setWordWrap(true);
+        optionalLabel->setText(i18n("These programs are optional: the images are fused by digiKam. "
+                                    "Enfuse is only used with the Color Appearance Model (CIECAM02), "
+                                    "and align_image_stack to align the bracketed images."));
+        binaryLayout->addWidget(optionalLabel, binaryLayout->rowCount(), 0);
+    }
+
 #ifdef Q_OS_OSX
     // Hugin bundle PKG install
     d->binariesWidget->addDirectory(QLatin1String("/Applications/Hugin/HuginTools"));
@@ -108,9 +119,9 @@ ExpoBlendingIntroPage::ExpoBlendingIntroPage(ExpoBlendingManager* const mngr, QW
 #endif
 
     connect(d->binariesWidget, SIGNAL(signalBinariesFound(bool)),
-            this, SIGNAL(signalExpoBlendingIntroPageIsValid(bool)));
+            this, SLOT(slotBinariesFound()));
 
-    emit signalExpoBlendingIntroPageIsValid(d->binariesWidget->allBinariesFound());
+    emit signalExpoBlendingIntroPageIsValid(binariesFound());
 
     setPageWidget(vbox);
 
@@ -125,7 +136,20 @@ ExpoBlendingIntroPage::~ExpoBlendingIntroPage()
 
 bool ExpoBlendingIntroPage::binariesFound()
 {
+    // With the native fusion, enfuse is only needed for CIECAM02 blending, and the pre-processing
+    // page disables the alignment when align_image_stack is not found: no binary is required.
+
+    if (d->mngr->thread()->nativeFusion())
+    {
+        return true;
+    }
+
     return d->binariesWidget->allBinariesFound();
 }
 
+void ExpoBlendingIntroPage::slotBinariesFound()
+{
+    emit signalExpoBlendingIntroPageIsValid(binariesFound());
+}
+
 } // namespace Digikam
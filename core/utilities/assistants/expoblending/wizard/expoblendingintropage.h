@@ -46,6 +46,10 @@ Q_SIGNALS:
 
     void signalExpoBlendingIntroPageIsValid(bool);
 
+private Q_SLOTS:
+
+    void slotBinariesFound();
+
 private:
 
     class Private;
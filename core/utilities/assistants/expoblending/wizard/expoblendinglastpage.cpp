@@ -37,6 +37,7 @@
 
 #include "enfusebinary.h"
 #include "expoblendingmanager.h"
+#include "expoblendingthread.h"
 #include "dlayoutbox.h"
 
 namespace Digikam
@@ -63,16 +64,32 @@ ExpoBlendingLastPage::ExpoBlendingLastPage(ExpoBlendingManager* const mngr, QWiz
     QLabel* const title     = new QLabel(vbox);
     title->setOpenExternalLinks(true);
     title->setWordWrap(true);
-    title->setText(i18n("<qt>"
-                        "<p><h1><b>Bracketed Images Pre-Processing is Done</b></h1></p>"
-                        "<p>Congratulations. Your images are ready to be fused. </p>"
-                        "<p>To perform this operation, <b>%1</b> program from "
-                        "<a href='%2'>Enblend</a> "
-                        "project will be used.</p>"
-                        "<p>Press \"Finish\" button to fuse your items and make a pseudo HDR image.</p>"
-                        "</qt>",
-                        QDir::toNativeSeparators(d->mngr->enfuseBinary().path()),
-                        d->mngr->enfuseBinary().url().url()));
+
+    if (d->mngr->thread()->nativeFusion())
+    {
+        title->setText(i18n("<qt>"
+                            "<p><h1><b>Bracketed Images Pre-Processing is Done</b></h1></p>"
+                            "<p>Congratulations. Your images are ready to be fused. </p>"
+                            "<p>The images will be fused by digiKam. With the Color Appearance Model (CIECAM02), "
+                            "<b>%1</b> program from <a href='%2'>Enblend</a> project will be used.</p>"
+                            "<p>Press \"Finish\" button to fuse your items and make a pseudo HDR image.</p>"
+                            "</qt>",
+                            QDir::toNativeSeparators(d->mngr->enfuseBinary().path()),
+                            d->mngr->enfuseBinary().url().url()));
+    }
+    else
+    {
+        title->setText(i18n("<qt>"
+                            "<p><h1><b>Bracketed Images Pre-Processing is Done</b></h1></p>"
+                            "<p>Congratulations. Your images are ready to be fused. </p>"
+                            "<p>To perform this operation, <b>%1</b> program from "
+                            "<a href='%2'>Enblend</a> "
+                            "project will be used.</p>"
+                            "<p>Press \"Finish\" button to fuse your items and make a pseudo HDR image.</p>"
+                            "</qt>",
+                            QDir::toNativeSeparators(d->mngr->enfuseBinary().path()),
+                            d->mngr->enfuseBinary().url().url()));
+    }
 
     vbox->setStretchFactor(new QWidget(vbox), 10);
 
@@ -101,6 +101,14 @@ ExpoBlendingPreProcessPage::ExpoBlendingPreProcessPage(ExpoBlendingManager* cons
     d->alignCheckBox   = new QCheckBox(i18nc("@option:check", "Align bracketed images"), vbox);
     d->alignCheckBox->setChecked(group.readEntry("Auto Alignment", true));
 
+    // Without align_image_stack, the images are fused without alignment.
+
+    if (!d->mngr->alignBinary().isValid())
+    {
+        d->alignCheckBox->setChecked(false);
+        d->alignCheckBox->setEnabled(false);
+    }
+
     vbox->setStretchFactor(new QWidget(vbox), 2);
 
     d->detailsText     = new QTextBrowser(vbox);
@@ -131,7 +139,12 @@ ExpoBlendingPreProcessPage::~ExpoBlendingPreProcessPage()
 {
     KConfig config;
     KConfigGroup group = config.group("ExpoBlending Settings");
-    group.writeEntry("Auto Alignment", d->alignCheckBox->isChecked());
+
+    if (d->alignCheckBox->isEnabled())
+    {
+        group.writeEntry("Auto Alignment", d->alignCheckBox->isChecked());
+    }
+
     config.sync();
 
     delete d;
@@ -168,6 +168,14 @@ GalleryConfig::GalleryConfig()
         = new KConfigSkeleton::ItemString(currentGroup(), QLatin1String("imageSelectionTitle"), m_imageSelectionTitle);
 
     addItem(itemimageSelectionTitle, QLatin1String("imageSelectionTitle"));
+
+    // -------------------
+
+    KConfigSkeleton::ItemBool* const itemincrementalExport
+        = new KConfigSkeleton::ItemBool(currentGroup(), QLatin1String("incrementalExport"),
+                                        m_incrementalExport, false);
+
+    addItem(itemincrementalExport, QLatin1String("incrementalExport"));
 }
 
 GalleryConfig::~GalleryConfig()
@@ -328,4 +336,15 @@ QString GalleryConfig::imageSelectionTitle() const
     return m_imageSelectionTitle;
 }
 
+void GalleryConfig::setIncrementalExport(bool v)
+{
+    if (!isImmutable(QLatin1String("incrementalExport")))
+        m_incrementalExport = v;
+}
+
+bool GalleryConfig::incrementalExport() const
+{
+    return m_incrementalExport;
+}
+
 } // namespace Digikam
@@ -31,7 +31,8 @@ namespace Digikam
 {
 
 GalleryElement::GalleryElement(const DInfoInterface::DInfoMap& info)
-    : m_valid(false)
+    : m_valid(false),
+      m_reused(false)
 {
     DItemInfo item(info);
     m_title       = item.name();
@@ -42,7 +43,8 @@ GalleryElement::GalleryElement(const DInfoInterface::DInfoMap& info)
 
 GalleryElement::GalleryElement()
     : m_valid(false),
-      m_orientation(MetaEngine::ORIENTATION_UNSPECIFIED)
+      m_orientation(MetaEngine::ORIENTATION_UNSPECIFIED),
+      m_reused(false)
 {
 }
 
@@ -33,6 +33,7 @@
 
 #include "dmetadata.h"
 #include "dinfointerface.h"
+#include "gallerymanifest.h"
 
 namespace Digikam
 {
@@ -65,6 +66,9 @@ public:
     QDateTime                    m_time;
 
     QString                      m_path;
+    QString                      m_baseFileName;   // Unique file name in the collection, without extension.
+    bool                         m_reused;         // Files reused from the previous export.
+    GalleryManifestEntry         m_manifestEntry;
 
     QString                      m_thumbnailFileName;
     QSize                        m_thumbnailSize;
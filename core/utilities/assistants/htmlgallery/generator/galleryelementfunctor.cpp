@@ -25,6 +25,7 @@
 
 // Qt includes
 
+#include <QCryptographicHash>
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
@@ -42,6 +43,7 @@
 #include "galleryinfo.h"
 #include "gallerygenerator.h"
 #include "galleryelement.h"
+#include "gallerymanifest.h"
 #include "metaengine_rotation.h"
 #include "drawdecoder.h"
 #include "drawinfo.h"
@@ -81,10 +83,14 @@ static QImage generateThumbnail(const QImage& fullImage, int size, bool square)
 
 GalleryElementFunctor::GalleryElementFunctor(GalleryGenerator* const generator,
                                              GalleryInfo* const info,
-                                             const QString& destDir)
+                                             const QString& destDir,
+                                             const QString& collectionFileName,
+                                             const GalleryManifest* const previousManifest)
     : m_generator(generator),
       m_info(info),
-      m_destDir(destDir)
+      m_destDir(destDir),
+      m_collectionFileName(collectionFileName),
+      m_previousManifest(previousManifest)
 {
 }
 
@@ -94,8 +100,22 @@ GalleryElementFunctor::~GalleryElementFunctor()
 
 void GalleryElementFunctor::operator()(GalleryElement& element)
 {
+    QString path                = element.m_path;
+    QFileInfo sourceInfo(path);
+    GalleryManifestEntry& entry = element.m_manifestEntry;
+    entry.collection            = m_collectionFileName;
+    entry.sourcePath            = path;
+    entry.fileSize              = sourceInfo.size();
+    entry.lastModified          = sourceInfo.lastModified();
+    entry.settings              = settingsKey(element);
+
+    if (m_previousManifest && reuseFiles(element))
+    {
+        readMetadata(element);
+        return;
+    }
+
     // Load image
-    QString    path = element.m_path;
     QImage     originalImage;
     QString    imageFormat;
     QByteArray imageData;
@@ -108,6 +128,8 @@ void GalleryElementFunctor::operator()(GalleryElement& element)
             emitWarning(i18n("Error loading RAW image '%1'", QDir::toNativeSeparators(path)));
             return;
         }
+
+        entry.sourceHash = GalleryManifest::fileHash(path);
     }
     else
     {
@@ -131,6 +153,8 @@ void GalleryElementFunctor::operator()(GalleryElement& element)
         imageData = imageFile.readAll();
         imageFile.close();
 
+        entry.sourceHash = QString::fromLatin1(QCryptographicHash::hash(imageData, QCryptographicHash::Md5).toHex());
+
         if (!originalImage.loadFromData(imageData))
         {
             emitWarning(i18n("Error loading image '%1'", QDir::toNativeSeparators(path)));
@@ -159,8 +183,7 @@ void GalleryElementFunctor::operator()(GalleryElement& element)
     QImage thumbnail     = generateThumbnail(fullImage, m_info->thumbnailSize(), m_info->thumbnailSquare());
 
     // Save images
-    QString baseFileName = GalleryGenerator::webifyFileName(element.m_title);
-    baseFileName         = m_uniqueNameHelper.makeNameUnique(baseFileName);
+    QString baseFileName = element.m_baseFileName;
 
     // Save full
     QString fullFileName;
@@ -222,7 +245,114 @@ void GalleryElementFunctor::operator()(GalleryElement& element)
     element.m_thumbnailSize     = thumbnail.size();
     element.m_valid             = true;
 
+    entry.fullFileName          = element.m_fullFileName;
+    entry.fullSize              = element.m_fullSize;
+    entry.thumbnailFileName     = element.m_thumbnailFileName;
+    entry.thumbnailSize         = element.m_thumbnailSize;
+    entry.originalFileName      = element.m_originalFileName;
+    entry.originalSize          = element.m_originalSize;
+
+    readMetadata(element);
+}
+
+QString GalleryElementFunctor::settingsKey(const GalleryElement& element) const
+{
+    QStringList key;
+    key << QString::number(m_info->useOriginalImageAsFullImage())
+        << QString::number(m_info->fullResize())
+        << QString::number(m_info->fullSize())
+        << m_info->fullFormatString()
+        << QString::number(m_info->fullQuality())
+        << QString::number(m_info->copyOriginalImage())
+        << QString::number(m_info->thumbnailSize())
+        << m_info->thumbnailFormatString()
+        << QString::number(m_info->thumbnailQuality())
+        << QString::number(m_info->thumbnailSquare())
+        << QString::number(element.m_orientation);
+
+    return key.join(QLatin1Char(';'));
+}
+
+bool GalleryElementFunctor::reuseFiles(GalleryElement& element)
+{
+    GalleryManifestEntry& current = element.m_manifestEntry;
+    const QString key             = m_collectionFileName + QLatin1Char('/') + element.m_baseFileName;
+
+    if (!m_previousManifest->contains(key))
+    {
+        return false;
+    }
+
+    GalleryManifestEntry previous = m_previousManifest->entry(key);
+
+    if (previous.sourcePath != current.sourcePath ||
+        previous.settings   != current.settings   ||
+        previous.fullFileName.isEmpty()           ||
+        previous.thumbnailFileName.isEmpty())
+    {
+        return false;
+    }
+
+    QStringList files;
+    files << previous.fullFileName << previous.thumbnailFileName;
+
+    if (!previous.originalFileName.isEmpty())
+    {
+        files << previous.originalFileName;
+    }
+
+    foreach (const QString& file, files)
+    {
+        if (!QFileInfo::exists(m_destDir + QLatin1Char('/') + file))
+        {
+            return false;
+        }
+    }
+
+    if (previous.fileSize != current.fileSize || previous.lastModified != current.lastModified)
+    {
+        // The file has been touched: compare the contents before generating the files again.
+
+        if (previous.fileSize != current.fileSize || previous.sourceHash.isEmpty())
+        {
+            return false;
+        }
+
+        current.sourceHash = GalleryManifest::fileHash(current.sourcePath);
+
+        if (current.sourceHash != previous.sourceHash)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        current.sourceHash = previous.sourceHash;
+    }
+
+    current.fullFileName        = previous.fullFileName;
+    current.fullSize            = previous.fullSize;
+    current.thumbnailFileName   = previous.thumbnailFileName;
+    current.thumbnailSize       = previous.thumbnailSize;
+    current.originalFileName    = previous.originalFileName;
+    current.originalSize        = previous.originalSize;
+
+    element.m_fullFileName      = previous.fullFileName;
+    element.m_fullSize          = previous.fullSize;
+    element.m_thumbnailFileName = previous.thumbnailFileName;
+    element.m_thumbnailSize     = previous.thumbnailSize;
+    element.m_originalFileName  = previous.originalFileName;
+    element.m_originalSize      = previous.originalSize;
+    element.m_reused            = true;
+    element.m_valid             = true;
+
+    return true;
+}
+
+void GalleryElementFunctor::readMetadata(GalleryElement& element)
+{
     // Read Exif Metadata
+    QString path = element.m_path;
     QString unavailable(i18n("unavailable"));
     DMetadata meta;
     meta.load(path);
@@ -24,9 +24,9 @@
 #ifndef DIGIKAM_GALLERY_ELEMENT_FUNCTOR_H
 #define DIGIKAM_GALLERY_ELEMENT_FUNCTOR_H
 
-// Local includes
+// Qt includes
 
-#include "gallerynamehelper.h"
+#include <QString>
 
 namespace Digikam
 {
@@ -34,11 +34,14 @@ namespace Digikam
 class GalleryInfo;
 class GalleryGenerator;
 class GalleryElement;
+class GalleryManifest;
 
 /**
  * This functor generates images (full and thumbnail) for an url and returns an
  * GalleryElement initialized to fill the xml writer.
  * It is used as an argument to QtConcurrent::mapped().
+ * If a manifest of a previous export is passed, the files of the images which did not
+ * change since this export are reused instead of being generated again.
  */
 class GalleryElementFunctor
 {
@@ -49,25 +52,32 @@ public:
 public:
 
     explicit GalleryElementFunctor(GalleryGenerator* const generator,
-                                    GalleryInfo* const info,
-                                    const QString& destDir);
+                                   GalleryInfo* const info,
+                                   const QString& destDir,
+                                   const QString& collectionFileName,
+                                   const GalleryManifest* const previousManifest = 0);
     ~GalleryElementFunctor();
 
     void operator()(GalleryElement& element);
 
 private:
 
-    bool writeDataToFile(const QByteArray& data, const QString& destPath);
-    void emitWarning(const QString& msg);
+    QString settingsKey(const GalleryElement& element) const;
+    bool    reuseFiles(GalleryElement& element);
+    void    readMetadata(GalleryElement& element);
+
+    bool    writeDataToFile(const QByteArray& data, const QString& destPath);
+    void    emitWarning(const QString& msg);
 
 private:
 
     // NOTE: Do not use a d private internal container here.
 
-    GalleryGenerator* m_generator;
-    GalleryInfo*      m_info;
-    QString           m_destDir;
-    GalleryNameHelper m_uniqueNameHelper;
+    GalleryGenerator*      m_generator;
+    GalleryInfo*           m_info;
+    QString                m_destDir;
+    QString                m_collectionFileName;
+    const GalleryManifest* m_previousManifest;
 };
 
 } // namespace Digikam
@@ -25,8 +25,12 @@
 
 // Qt includes
 
+#include <QCryptographicHash>
 #include <QDir>
+#include <QFile>
+#include <QFileInfo>
 #include <QFutureWatcher>
+#include <QSet>
 #include <QRegExp>
 #include <QStringList>
 #include <QtConcurrentMap>
@@ -53,6 +57,8 @@
 #include "galleryelement.h"
 #include "galleryelementfunctor.h"
 #include "galleryinfo.h"
+#include "gallerymanifest.h"
+#include "gallerynamehelper.h"
 #include "gallerytheme.h"
 #include "galleryxmlutils.h"
 #include "htmlwizard.h"
@@ -80,7 +86,11 @@ public:
         warnings(false),
         cancel(false),
         pview(0),
-        pbar(0)
+        pbar(0),
+        reusedCount(0),
+        generatedCount(0),
+        removedCount(0),
+        pagesGenerated(false)
     {
     }
 
@@ -96,6 +106,14 @@ public:
     DHistoryView*     pview;
     DProgressWdg*     pbar;
 
+    // Incremental export
+    GalleryManifest   previousManifest;
+    GalleryManifest   manifest;
+    int               reusedCount;
+    int               generatedCount;
+    int               removedCount;
+    bool              pagesGenerated;
+
 public:
 
     bool init()
@@ -112,6 +130,18 @@ public:
         pview->setVisible(true);
         pbar->setVisible(true);
 
+        manifest         = GalleryManifest();
+        previousManifest = GalleryManifest();
+        reusedCount      = 0;
+        generatedCount   = 0;
+        removedCount     = 0;
+        pagesGenerated   = false;
+
+        if (info->incrementalExport())
+        {
+            previousManifest.load(GalleryManifest::manifestPath(info->destUrl().toLocalFile()));
+        }
+
         return true;
     }
 
@@ -209,7 +239,7 @@ public:
                     imageList = info->m_iface->albumsItems(DInfoInterface::DAlbumIDs() << id);
                 }
 
-                if (!processImages(xmlWriter, imageList, title, destDir))
+                if (!processImages(xmlWriter, imageList, title, collectionFileName, destDir))
                     return false;
             }
         }
@@ -228,7 +258,7 @@ public:
             xmlWriter.writeElement("name",     title);
             xmlWriter.writeElement("fileName", collectionFileName);
 
-            if (!processImages(xmlWriter, info->m_imageList, title, destDir))
+            if (!processImages(xmlWriter, info->m_imageList, title, collectionFileName, destDir))
                 return false;
         }
 
@@ -236,7 +266,8 @@ public:
     }
 
     bool processImages(XMLWriter& xmlWriter, const QList<QUrl>& imageList,
-                       const QString& title, const QString& destDir)
+                       const QString& title, const QString& collectionFileName,
+                       const QString& destDir)
     {
         RemoteUrlHash remoteUrlHash;
 
@@ -246,6 +277,7 @@ public:
         }
 
         QList<GalleryElement> imageElementList;
+        GalleryNameHelper     nameHelper;
 
         foreach(const QUrl& url, imageList)
         {
@@ -263,12 +295,16 @@ public:
 
             GalleryElement element = GalleryElement(inf);
             element.m_path         = remoteUrlHash.value(url, url.toLocalFile());
+
+            // Names are given in the order of the album, to find the files of a previous export.
+            element.m_baseFileName = nameHelper.makeNameUnique(webifyFileName(element.m_title));
             imageElementList << element;
         }
 
         // Generate images
         logInfo(i18n("Generating files for \"%1\"", title));
-        GalleryElementFunctor functor(that, info, destDir);
+        GalleryElementFunctor functor(that, info, destDir, collectionFileName,
+                                      info->incrementalExport() ? &previousManifest : 0);
         QFuture<void> future = QtConcurrent::map(imageElementList, functor);
         QFutureWatcher<void> watcher;
         watcher.setFuture(future);
@@ -294,16 +330,115 @@ public:
         foreach(const GalleryElement& element, imageElementList)
         {
             element.appendToXML(xmlWriter, info->copyOriginalImage());
+
+            if (!element.m_valid)
+            {
+                continue;
+            }
+
+            manifest.insert(collectionFileName + QLatin1Char('/') + element.m_baseFileName,
+                            element.m_manifestEntry);
+
+            if (element.m_reused)
+            {
+                ++reusedCount;
+            }
+            else
+            {
+                ++generatedCount;
+            }
         }
 
         return true;
     }
 
+    /**
+     * Remove the files of the previous export which are not part of the gallery anymore,
+     * and the album folders left empty.
+     */
+    void removeObsoleteFiles()
+    {
+        const QString baseDestDir   = info->destUrl().toLocalFile();
+        const QSet<QString> current = manifest.outputFiles().toSet();
+        QSet<QString> folders;
+
+        foreach (const QString& file, previousManifest.outputFiles())
+        {
+            if (current.contains(file))
+            {
+                continue;
+            }
+
+            const QString path = baseDestDir + QLatin1Char('/') + file;
+
+            if (QFile::remove(path))
+            {
+                ++removedCount;
+            }
+
+            folders << QFileInfo(path).path();
+        }
+
+        foreach (const QString& folder, folders)
+        {
+            // Only succeeds if the folder is empty.
+            QDir().rmdir(folder);
+        }
+    }
+
+    /**
+     * Return a hash of all the inputs of the XSLT processing.
+     */
+    QString pagesHash(const QString& xsltFileName, const XsltParameterMap& map) const
+    {
+        QCryptographicHash md5(QCryptographicHash::Md5);
+        QFile xmlFile(xmlFileName);
+        QFile xsltFile(xsltFileName);
+
+        if (xmlFile.open(QIODevice::ReadOnly))
+        {
+            md5.addData(&xmlFile);
+        }
+
+        if (xsltFile.open(QIODevice::ReadOnly))
+        {
+            md5.addData(&xsltFile);
+        }
+
+        for (XsltParameterMap::ConstIterator it = map.constBegin() ; it != map.constEnd() ; ++it)
+        {
+            md5.addData(it.key());
+            md5.addData("=", 1);
+            md5.addData(it.value());
+        }
+
+        return QString::fromLatin1(md5.result().toHex());
+    }
+
     bool generateHTML()
     {
         logInfo(i18n("Generating HTML files"));
 
         QString xsltFileName                                 = theme->directory() + QLatin1String("/template.xsl");
+        QString destFileName                                 = QDir::toNativeSeparators(info->destUrl().toLocalFile() +
+                                                                                        QLatin1String("/index.html"));
+
+        // Prepare parameters
+        XsltParameterMap map;
+        addI18nParameters(map);
+        addThemeParameters(map);
+
+        // All the pages are produced by a single XSLT pass over the whole gallery.
+        // Skip it if nothing changed since the previous export.
+        QString hash = pagesHash(xsltFileName, map);
+        manifest.setPagesHash(hash);
+
+        if (info->incrementalExport() && hash == previousManifest.pagesHash() && QFile::exists(destFileName))
+        {
+            logInfo(i18n("HTML files are up to date"));
+            return true;
+        }
+
         CWrapper<xsltStylesheetPtr, xsltFreeStylesheet> xslt = xsltParseStylesheetFile((const xmlChar*)
             QDir::toNativeSeparators(xsltFileName).toUtf8().data());
 
@@ -322,11 +457,6 @@ public:
             return false;
         }
 
-        // Prepare parameters
-        XsltParameterMap map;
-        addI18nParameters(map);
-        addThemeParameters(map);
-
         const char** params            = new const char*[map.size()*2+1];
         XsltParameterMap::Iterator it  = map.begin();
         XsltParameterMap::Iterator end = map.end();
@@ -358,15 +488,14 @@ public:
             return false;
         }
 
-        QString destFileName = QDir::toNativeSeparators(info->destUrl().toLocalFile() + 
-                                                        QLatin1String("/index.html"));
-
         if (xsltSaveResultToFilename(destFileName.toUtf8().data(), xmlOutput, xslt, 0) == -1)
         {
             logError(i18n("Could not open '%1' for writing", destFileName));
             return false;
         }
 
+        pagesGenerated = true;
+
         return true;
     }
 
@@ -590,6 +719,8 @@ bool GalleryGenerator::run()
     if (!d->generateImagesAndXML())
         return false;
 
+    d->removeObsoleteFiles();
+
     exsltRegisterAll();
 
     bool result = d->generateHTML();
@@ -597,7 +728,23 @@ bool GalleryGenerator::run()
     xsltCleanupGlobals();
     xmlCleanupParser();
 
-    return result;
+    if (!result)
+        return false;
+
+    if (!d->manifest.save(GalleryManifest::manifestPath(destDir)))
+    {
+        d->logWarning(i18n("Could not save the gallery manifest"));
+    }
+
+    d->logInfo(i18n("%1 images reused, %2 images generated, %3 obsolete files removed",
+                    d->reusedCount, d->generatedCount, d->removedCount));
+
+    qCDebug(DIGIKAM_GENERAL_LOG) << "Gallery export: reused" << d->reusedCount
+                                 << "generated" << d->generatedCount
+                                 << "removed" << d->removedCount
+                                 << "pages generated" << d->pagesGenerated;
+
+    return true;
 }
 
 bool GalleryGenerator::warnings() const
@@ -0,0 +1,257 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : a tool to generate HTML image galleries
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "gallerymanifest.h"
+
+// Qt includes
+
+#include <QCryptographicHash>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+
+// Local includes
+
+#include "digikam_debug.h"
+
+namespace Digikam
+{
+
+GalleryManifestEntry::GalleryManifestEntry()
+    : fileSize(0)
+{
+}
+
+GalleryManifestEntry::~GalleryManifestEntry()
+{
+}
+
+QStringList GalleryManifestEntry::outputFiles() const
+{
+    QStringList files;
+
+    if (!fullFileName.isEmpty())
+    {
+        files << collection + QLatin1Char('/') + fullFileName;
+    }
+
+    if (!thumbnailFileName.isEmpty())
+    {
+        files << collection + QLatin1Char('/') + thumbnailFileName;
+    }
+
+    if (!originalFileName.isEmpty())
+    {
+        files << collection + QLatin1Char('/') + originalFileName;
+    }
+
+    return files;
+}
+
+// ---------------------------------------------------------------------
+
+static QJsonArray sizeToJson(const QSize& size)
+{
+    return (QJsonArray() << size.width() << size.height());
+}
+
+static QSize sizeFromJson(const QJsonValue& value)
+{
+    QJsonArray array = value.toArray();
+
+    if (array.size() != 2)
+    {
+        return QSize();
+    }
+
+    return QSize(array.at(0).toInt(), array.at(1).toInt());
+}
+
+GalleryManifest::GalleryManifest()
+{
+}
+
+GalleryManifest::~GalleryManifest()
+{
+}
+
+QString GalleryManifest::manifestPath(const QString& destDir)
+{
+    return destDir + QLatin1String("/.digikam-gallery-manifest.json");
+}
+
+QString GalleryManifest::fileHash(const QString& filePath)
+{
+    QFile file(filePath);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return QString();
+    }
+
+    QCryptographicHash md5(QCryptographicHash::Md5);
+
+    if (!md5.addData(&file))
+    {
+        return QString();
+    }
+
+    return QString::fromLatin1(md5.result().toHex());
+}
+
+bool GalleryManifest::load(const QString& filePath)
+{
+    m_entries.clear();
+    m_pagesHash.clear();
+
+    QFile file(filePath);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll());
+
+    if (!doc.isObject())
+    {
+        qCWarning(DIGIKAM_GENERAL_LOG) << "Invalid gallery manifest" << filePath;
+        return false;
+    }
+
+    QJsonObject root  = doc.object();
+    m_pagesHash       = root.value(QLatin1String("pagesHash")).toString();
+    QJsonObject items = root.value(QLatin1String("items")).toObject();
+
+    for (QJsonObject::const_iterator it = items.constBegin() ; it != items.constEnd() ; ++it)
+    {
+        QJsonObject obj = it.value().toObject();
+        GalleryManifestEntry entry;
+
+        entry.collection        = obj.value(QLatin1String("collection")).toString();
+        entry.sourcePath        = obj.value(QLatin1String("sourcePath")).toString();
+        entry.fileSize          = (qint64)obj.value(QLatin1String("fileSize")).toDouble();
+        entry.lastModified      = QDateTime::fromMSecsSinceEpoch((qint64)obj.value(QLatin1String("lastModified")).toDouble());
+        entry.sourceHash        = obj.value(QLatin1String("sourceHash")).toString();
+        entry.settings          = obj.value(QLatin1String("settings")).toString();
+        entry.fullFileName      = obj.value(QLatin1String("full")).toString();
+        entry.fullSize          = sizeFromJson(obj.value(QLatin1String("fullSize")));
+        entry.thumbnailFileName = obj.value(QLatin1String("thumbnail")).toString();
+        entry.thumbnailSize     = sizeFromJson(obj.value(QLatin1String("thumbnailSize")));
+        entry.originalFileName  = obj.value(QLatin1String("original")).toString();
+        entry.originalSize      = sizeFromJson(obj.value(QLatin1String("originalSize")));
+
+        m_entries.insert(it.key(), entry);
+    }
+
+    return true;
+}
+
+bool GalleryManifest::save(const QString& filePath) const
+{
+    QJsonObject items;
+
+    for (QHash<QString, GalleryManifestEntry>::const_iterator it = m_entries.constBegin() ;
+         it != m_entries.constEnd() ; ++it)
+    {
+        const GalleryManifestEntry& entry = it.value();
+        QJsonObject obj;
+
+        obj.insert(QLatin1String("collection"),    entry.collection);
+        obj.insert(QLatin1String("sourcePath"),    entry.sourcePath);
+        obj.insert(QLatin1String("fileSize"),      (double)entry.fileSize);
+        obj.insert(QLatin1String("lastModified"),  (double)entry.lastModified.toMSecsSinceEpoch());
+        obj.insert(QLatin1String("sourceHash"),    entry.sourceHash);
+        obj.insert(QLatin1String("settings"),      entry.settings);
+        obj.insert(QLatin1String("full"),          entry.fullFileName);
+        obj.insert(QLatin1String("fullSize"),      sizeToJson(entry.fullSize));
+        obj.insert(QLatin1String("thumbnail"),     entry.thumbnailFileName);
+        obj.insert(QLatin1String("thumbnailSize"), sizeToJson(entry.thumbnailSize));
+        obj.insert(QLatin1String("original"),      entry.originalFileName);
+        obj.insert(QLatin1String("originalSize"),  sizeToJson(entry.originalSize));
+
+        items.insert(it.key(), obj);
+    }
+
+    QJsonObject root;
+    root.insert(QLatin1String("pagesHash"), m_pagesHash);
+    root.insert(QLatin1String("items"),     items);
+
+    // Write the whole manifest or nothing, a truncated manifest would lose the previous export.
+
+    QSaveFile file(filePath);
+
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        return false;
+    }
+
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+
+    return file.commit();
+}
+
+bool GalleryManifest::contains(const QString& key) const
+{
+    return m_entries.contains(key);
+}
+
+GalleryManifestEntry GalleryManifest::entry(const QString& key) const
+{
+    return m_entries.value(key);
+}
+
+void GalleryManifest::insert(const QString& key, const GalleryManifestEntry& entry)
+{
+    m_entries.insert(key, entry);
+}
+
+QStringList GalleryManifest::keys() const
+{
+    return m_entries.keys();
+}
+
+QStringList GalleryManifest::outputFiles() const
+{
+    QStringList files;
+
+    foreach (const GalleryManifestEntry& entry, m_entries)
+    {
+        files << entry.outputFiles();
+    }
+
+    return files;
+}
+
+void GalleryManifest::setPagesHash(const QString& hash)
+{
+    m_pagesHash = hash;
+}
+
+QString GalleryManifest::pagesHash() const
+{
+    return m_pagesHash;
+}
+
+} // namespace Digikam
@@ -0,0 +1,121 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : a tool to generate HTML image galleries
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_GALLERY_MANIFEST_H
+#define DIGIKAM_GALLERY_MANIFEST_H
+
+// Qt includes
+
+#include <QDateTime>
+#include <QHash>
+#include <QSize>
+#include <QString>
+#include <QStringList>
+
+namespace Digikam
+{
+
+/**
+ * The files generated for one image of the gallery, with the state of the source
+ * image and the settings used to generate them.
+ */
+class GalleryManifestEntry
+{
+public:
+
+    explicit GalleryManifestEntry();
+    ~GalleryManifestEntry();
+
+    /**
+     * Return the generated files, relative to the gallery folder.
+     */
+    QStringList outputFiles() const;
+
+public:
+
+    QString   collection;           // Folder of the album in the gallery.
+    QString   sourcePath;
+    qint64    fileSize;
+    QDateTime lastModified;
+    QString   sourceHash;           // MD5 of the source file contents.
+    QString   settings;             // Settings used to generate the files.
+
+    QString   fullFileName;
+    QSize     fullSize;
+    QString   thumbnailFileName;
+    QSize     thumbnailSize;
+    QString   originalFileName;
+    QSize     originalSize;
+};
+
+// ---------------------------------------------------------------------
+
+/**
+ * The manifest of an exported gallery, stored in the gallery folder. It is used by the
+ * incremental export to reuse the files of the images which did not change since the
+ * previous export and to remove the files which are not part of the gallery anymore.
+ */
+class GalleryManifest
+{
+public:
+
+    explicit GalleryManifest();
+    ~GalleryManifest();
+
+    /**
+     * Return the path of the manifest file in a gallery folder.
+     */
+    static QString manifestPath(const QString& destDir);
+
+    /**
+     * Return the MD5 of the contents of a file, or an empty string if it cannot be read.
+     */
+    static QString fileHash(const QString& filePath);
+
+    bool load(const QString& filePath);
+    bool save(const QString& filePath) const;
+
+    bool                 contains(const QString& key) const;
+    GalleryManifestEntry entry(const QString& key)    const;
+    void                 insert(const QString& key, const GalleryManifestEntry& entry);
+    QStringList          keys()                       const;
+
+    /**
+     * Return all the files generated for the images, relative to the gallery folder.
+     */
+    QStringList          outputFiles()                const;
+
+    /**
+     * The hash of the gallery XML file and of the XSLT parameters used to generate the pages.
+     */
+    void                 setPagesHash(const QString& hash);
+    QString              pagesHash()                  const;
+
+private:
+
+    QHash<QString, GalleryManifestEntry> m_entries;
+    QString                              m_pagesHash;
+};
+
+} // namespace Digikam
+
+#endif // DIGIKAM_GALLERY_MANIFEST_H
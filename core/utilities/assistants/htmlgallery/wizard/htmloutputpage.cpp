@@ -30,6 +30,7 @@
 #include <QWidget>
 #include <QApplication>
 #include <QStyle>
+#include <QCheckBox>
 #include <QComboBox>
 #include <QLineEdit>
 #include <QGridLayout>
@@ -55,7 +56,8 @@ public:
       : destUrl(0),
         openInBrowser(0),
         titleLabel(0),
-        imageSelectionTitle(0)
+        imageSelectionTitle(0),
+        incrementalExport(0)
     {
     }
 
@@ -63,6 +65,7 @@ public:
     QComboBox*     openInBrowser;
     QLabel*        titleLabel;
     QLineEdit*     imageSelectionTitle;
+    QCheckBox*     incrementalExport;
 };
 
 HTMLOutputPage::HTMLOutputPage(QWizard* const dialog, const QString& title)
@@ -107,6 +110,15 @@ HTMLOutputPage::HTMLOutputPage(QWizard* const dialog, const QString& title)
 
     // --------------------
 
+    d->incrementalExport       = new QCheckBox(main);
+    d->incrementalExport->setText(i18n("Update previous export incrementally"));
+    d->incrementalExport->setWhatsThis(i18n("Reuse the images generated by a previous export "
+                                            "in the destination folder when the source image and "
+                                            "the image settings did not change, and remove the "
+                                            "images which are not part of the gallery anymore."));
+
+    // --------------------
+
     QGridLayout* const grid = new QGridLayout(main);
     grid->setSpacing(QApplication::style()->pixelMetric(QStyle::PM_DefaultLayoutSpacing));
     grid->addWidget(d->titleLabel,          0, 0, 1, 1);
@@ -115,7 +127,8 @@ HTMLOutputPage::HTMLOutputPage(QWizard* const dialog, const QString& title)
     grid->addWidget(d->destUrl,             1, 1, 1, 1);
     grid->addWidget(browserLabel,           2, 0, 1, 1);
     grid->addWidget(d->openInBrowser,       2, 1, 1, 1);
-    grid->setRowStretch(3, 10);
+    grid->addWidget(d->incrementalExport,   3, 0, 1, 2);
+    grid->setRowStretch(4, 10);
 
     // --------------------
 
@@ -149,6 +162,7 @@ void HTMLOutputPage::initializePage()
     d->destUrl->setFileDlgPath(info->destUrl().toLocalFile());
     d->openInBrowser->setCurrentIndex(info->openInBrowser());
     d->imageSelectionTitle->setText(info->imageSelectionTitle());
+    d->incrementalExport->setChecked(info->incrementalExport());
 
     d->titleLabel->setVisible(info->m_getOption == GalleryInfo::IMAGES);
     d->imageSelectionTitle->setVisible(info->m_getOption == GalleryInfo::IMAGES);
@@ -172,6 +186,7 @@ bool HTMLOutputPage::validatePage()
     info->setDestUrl(QUrl::fromLocalFile(d->destUrl->fileDlgPath()));
     info->setOpenInBrowser(d->openInBrowser->currentIndex());
     info->setImageSelectionTitle(d->imageSelectionTitle->text());
+    info->setIncrementalExport(d->incrementalExport->isChecked());
 
     return true;
 }
@@ -33,6 +33,15 @@
 #include <QSize>
 #include <QPainter>
 #include <QFileInfo>
+#include <QFuture>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QQueue>
+#include <QThread>
+#include <QThreadPool>
+#include <QVector>
+#include <QWaitCondition>
+#include <QtConcurrent>    // krazy:exclude=includes
 
 // KDE includes
 
@@ -62,6 +71,119 @@ using namespace QtAV;
 namespace Digikam
 {
 
+/**
+ * A bounded queue of video frames, filled by a render job and emptied by the encoder.
+ * push() blocks while the queue is full, pop() blocks while the queue is empty and
+ * the producer is not done.
+ */
+class Q_DECL_HIDDEN VidSlideFrameQueue
+{
+public:
+
+    explicit VidSlideFrameQueue(int capacity)
+        : m_capacity(capacity),
+          m_done(false),
+          m_cancel(false)
+    {
+    }
+
+    /**
+     * Return false if the queue was cancelled and the frame dropped.
+     */
+    bool push(const VideoFrame& frame)
+    {
+        QMutexLocker lock(&m_mutex);
+
+        while (m_frames.count() >= m_capacity && !m_cancel)
+        {
+            m_notFull.wait(&m_mutex);
+        }
+
+        if (m_cancel)
+        {
+            return false;
+        }
+
+        m_frames.enqueue(frame);
+        m_notEmpty.wakeAll();
+
+        return true;
+    }
+
+    /**
+     * Return false when all frames from the producer were returned, or if the queue was cancelled.
+     */
+    bool pop(VideoFrame& frame)
+    {
+        QMutexLocker lock(&m_mutex);
+
+        while (m_frames.isEmpty() && !m_done && !m_cancel)
+        {
+            m_notEmpty.wait(&m_mutex);
+        }
+
+        if (m_frames.isEmpty() || m_cancel)
+        {
+            return false;
+        }
+
+        frame = m_frames.dequeue();
+        m_notFull.wakeAll();
+
+        return true;
+    }
+
+    void setDone()
+    {
+        QMutexLocker lock(&m_mutex);
+        m_done = true;
+        m_notEmpty.wakeAll();
+    }
+
+    void cancel()
+    {
+        QMutexLocker lock(&m_mutex);
+        m_cancel = true;
+        m_frames.clear();
+        m_notEmpty.wakeAll();
+        m_notFull.wakeAll();
+    }
+
+private:
+
+    int                 m_capacity;
+    bool                m_done;
+    bool                m_cancel;
+    QQueue<VideoFrame>  m_frames;
+    QMutex              m_mutex;
+    QWaitCondition      m_notFull;
+    QWaitCondition      m_notEmpty;
+};
+
+// -------------------------------------------------------
+
+/**
+ * A slideshow segment in the rendering pipeline. Segment n holds the effect frames of the
+ * image n-1 followed by the transition frames from the image n-1 to the image n. The first
+ * and the last segments have a transition with a black frame.
+ */
+class Q_DECL_HIDDEN VidSlideSegment
+{
+public:
+
+    explicit VidSlideSegment()
+        : index(0),
+          queue(0)
+    {
+    }
+
+    int                  index;
+    VidSlideFrameQueue*  queue;
+    QFuture<void>        future;
+};
+
+// -------------------------------------------------------
+
 class Q_DECL_HIDDEN VidSlideTask::Private
 {
 public:
@@ -85,6 +207,16 @@ public:
 
     AudioFrame nextAudioFrame(const AudioFormat& afmt);
 
+    /**
+     * Render the frames of a segment, converted to the pixel format of the encoder, to the queue.
+     * prevImage and image are the framed images loaded by the loading stage.
+     */
+    void       renderSegment(int index,
+                             QFuture<QImage> prevImage,
+                             QFuture<QImage> image,
+                             VidSlideFrameQueue* const queue,
+                             VideoFormat::PixelFormat format);
+
 public:
 
     VidSlideSettings*           settings;
@@ -96,6 +228,71 @@ public:
     QList<QUrl>::const_iterator curAudioFile;
 };
 
+void VidSlideTask::Private::renderSegment(int index,
+                                          QFuture<QImage> prevImage,
+                                          QFuture<QImage> image,
+                                          VidSlideFrameQueue* const queue,
+                                          VideoFormat::PixelFormat format)
+{
+    QSize  osize = settings->videoSize();
+    QImage qiimg = prevImage.result();
+    QImage qoimg = image.result();
+    int    tmout = 0;
+
+    // -- Effect frames of the previous image ----------
+
+    if (index > 0)
+    {
+        EffectMngr effmngr;
+        effmngr.setOutputSize(osize);
+        effmngr.setFrames(settings->imgFrames);
+        effmngr.setImage(qiimg);
+        effmngr.setEffect(settings->vEffect);
+
+        for (int count = 0 ; count < settings->imgFrames ; ++count)
+        {
+            qiimg = effmngr.currentFrame(tmout);
+            VideoFrame frame(qiimg);
+
+            if (frame.pixelFormat() != format)
+            {
+                frame = frame.to(format);
+            }
+
+            if (!queue->push(frame))
+            {
+                return;
+            }
+        }
+    }
+
+    // -- Transition frames to the image ----------
+
+    TransitionMngr transmngr;
+    transmngr.setOutputSize(osize);
+    transmngr.setInImage(qiimg);
+    transmngr.setOutImage(qoimg);
+    transmngr.setTransition(settings->transition);
+
+    do
+    {
+        VideoFrame frame(transmngr.currentFrame(tmout));
+
+        if (frame.pixelFormat() != format)
+        {
+            frame = frame.to(format);
+        }
+
+        if (!queue->push(frame))
+        {
+            return;
+        }
+    }
+    while (tmout != -1);
+
+    queue->setDone();
+}
+
 bool VidSlideTask::Private::encodeFrame(VideoFrame& vframe,
                                         VideoEncoder* const venc,
                                         AudioEncoder* const aenc,
@@ -326,89 +523,111 @@ void VidSlideTask::run()
         return;
     }
 
-    QImage qiimg;
-
     // ---------------------------------------------
-    // Loop to encode frames with images list
+    // Pipeline to encode frames with images list.
+    // Images are loaded and scaled in a first pool, segments frames are rendered in parallel
+    // in a second pool, and this thread encodes the frames segment after segment, in order.
+    // Segments in flight and frames queued by segment are bounded to limit the memory used.
 
-    TransitionMngr transmngr;
-    transmngr.setOutputSize(osize);
+    const int count = d->settings->inputImages.count();
+    const int jobs  = qMax(QThread::idealThreadCount(), 1);
 
-    EffectMngr effmngr;
-    effmngr.setOutputSize(osize);
-    effmngr.setFrames(d->settings->imgFrames);
+    QThreadPool loadPool;
+    loadPool.setMaxThreadCount(jobs);
 
-    for (int i = 0 ; i < d->settings->inputImages.count()+1 && !m_cancel ; ++i)
+    QThreadPool renderPool;
+    renderPool.setMaxThreadCount(jobs);
+
+    // Framed images, image n is at index n+1. The first and the last images are black frames.
+
+    QVector<QFuture<QImage> > images(count + 2);
+    QQueue<VidSlideSegment>   segments;
+    int                       nextImage   = 0;
+    int                       nextSegment = 0;
+
+    while ((nextSegment <= count || !segments.isEmpty()) && !m_cancel)
     {
-        if (i == 0)
+        // -- Fill the pipeline ----------
+
+        while (nextSegment <= count && segments.count() < jobs)
         {
-            qiimg = FrameUtils::makeFramedImage(QString(), osize);
-        }
+            // Segment n needs the images n-1 and n, the loading stage runs one window ahead.
 
-        QString ofile;
+            for ( ; nextImage < qMin(nextSegment + jobs + 2, count + 2) ; ++nextImage)
+            {
+                QString ofile;
 
-        if (i < d->settings->inputImages.count())
-        {
-            ofile = d->settings->inputImages[i].toLocalFile();
-        }
+                if (nextImage >= 1 && nextImage <= count)
+                {
+                    ofile = d->settings->inputImages[nextImage - 1].toLocalFile();
+                }
 
-        QImage qoimg = FrameUtils::makeFramedImage(ofile, osize);
+                images[nextImage] = QtConcurrent::run(&loadPool, &FrameUtils::makeFramedImage, ofile, osize);
+            }
 
-        // -- Transition encoding ----------
+            VidSlideSegment segment;
+            segment.index  = nextSegment;
+            segment.queue  = new VidSlideFrameQueue(4);
+            segment.future = QtConcurrent::run(&renderPool, d, &Private::renderSegment,
+                                               nextSegment, images[nextSegment], images[nextSegment + 1],
+                                               segment.queue, venc->pixelFormat());
+            segments.enqueue(segment);
+            ++nextSegment;
+        }
 
-        transmngr.setInImage(qiimg);
-        transmngr.setOutImage(qoimg);
-        transmngr.setTransition(d->settings->transition);
+        // -- Encode the frames of the oldest segment ----------
 
-        int tmout = 0;
+        VidSlideSegment segment = segments.dequeue();
+        VideoFrame      frame;
 
-        do
+        while (!m_cancel && segment.queue->pop(frame))
         {
-            VideoFrame frame(transmngr.currentFrame(tmout));
-
             if (!d->encodeFrame(frame, venc, aenc, mux))
             {
-                qCWarning(DIGIKAM_GENERAL_LOG) << "Cannot encode transition frame";
+                qCWarning(DIGIKAM_GENERAL_LOG) << "Cannot encode frame from segment" << segment.index;
             }
         }
-        while (tmout != -1 && !m_cancel);
 
-        // -- Images encoding ----------
+        segment.queue->cancel();
+        segment.future.waitForFinished();
+        delete segment.queue;
+
+        // The image before this segment is not used anymore.
 
-        if (i < d->settings->inputImages.count())
+        images[segment.index] = QFuture<QImage>();
+
+        if (m_cancel)
         {
-            VideoFrame frame;
-            int count = 0;
-            int tmout = 0;
-            effmngr.setImage(qoimg);
-            effmngr.setEffect(d->settings->vEffect);
+            break;
+        }
 
-            do
-            {
-                qiimg = effmngr.currentFrame(tmout);
-                frame = VideoFrame(qiimg);
+        if (segment.index > 0)
+        {
+            qCDebug(DIGIKAM_GENERAL_LOG) << "Encoded image" << segment.index - 1 << "done";
 
-                if (d->encodeFrame(frame, venc, aenc, mux))
-                {
+            emit signalMessage(i18n("Encoding %1 Done",
+                                    d->settings->inputImages[segment.index - 1].toLocalFile()), false);
+            emit signalProgress(segment.index - 1);
+        }
 
-                    ++count;
-/*
-                    qCDebug(DIGIKAM_GENERAL_LOG) << ofile
-                                                 << " => encode count:" << count
-                                                 << "frame size:"       << frame.width()
-                                                 << "x"                 << frame.height();
-*/
-                }
-            }
-            while (count < d->settings->imgFrames && !m_cancel);
+        if (segment.index == count)
+        {
+            emit signalProgress(count);
         }
+    }
 
-        qCDebug(DIGIKAM_GENERAL_LOG) << "Encoded image" << i << "done";
+    // Release the render jobs still in flight if the task was cancelled.
 
-        emit signalMessage(i18n("Encoding %1 Done", ofile), false);
-        emit signalProgress(i);
+    while (!segments.isEmpty())
+    {
+        VidSlideSegment segment = segments.dequeue();
+        segment.queue->cancel();
+        segment.future.waitForFinished();
+        delete segment.queue;
     }
 
+    loadPool.waitForDone();
+
     // ---------------------------------------------
     // Get delayed frames
 
@@ -43,6 +43,8 @@ DetectionBenchmarker::DetectionBenchmarker(FacePipeline::Private* const d)
       truePositiveFaces(0),
       falseNegativeFaces(0),
       falsePositiveFaces(0),
+      totalDetectionTime(0),
+      maxDetectionTime(0),
       d(d)
 {
 }
@@ -52,7 +54,16 @@ void DetectionBenchmarker::process(FacePipelineExtendedPackage::Ptr package)
     if (package->databaseFaces.isEmpty())
     {
         // Detection / Recognition
-        qCDebug(DIGIKAM_GENERAL_LOG) << "Benchmarking image" << package->info.name();
+        qCDebug(DIGIKAM_GENERAL_LOG) << "Benchmarking image" << package->info.name()
+                                     << "detected in" << package->detectionTime << "ms";
+
+        if (!elapsed.isValid())
+        {
+            elapsed.start();
+        }
+
+        totalDetectionTime += package->detectionTime;
+        maxDetectionTime    = qMax(maxDetectionTime, package->detectionTime);
 
         FaceUtils utils;
         QList<FaceTagsIface> groundTruth = utils.databaseFaces(package->info.id());
@@ -161,7 +172,12 @@ QString DetectionBenchmarker::result() const
     double falsePositiveRate = double(falsePositiveImages) / negativeImages;
     // per-face
     double sensitivity       = double(truePositiveFaces)   / trueFaces;
-    double ppv               = double(truePositiveFaces)   / (truePositiveFaces + falsePositiveFaces);
+    double ppv               = double(truePositiveFaces)   / qMax(1, truePositiveFaces + falsePositiveFaces);
+    double f1Score           = (sensitivity + ppv) > 0.0 ? 2 * sensitivity * ppv / (sensitivity + ppv) : 0.0;
+    // speed
+    double meanTime          = double(totalDetectionTime)  / qMax(1, totalImages);
+    double wallTime          = elapsed.isValid() ? double(elapsed.elapsed()) / 1000 : 0.0;
+    double throughput        = wallTime > 0.0 ? totalImages / wallTime : 0.0;
 
     return QString::fromUtf8("<p>"
                              "<u>Collection Properties:</u><br/>"
@@ -180,6 +196,14 @@ QString DetectionBenchmarker::result() const
                              "<u>Per-Face Performance:</u> <br/>"
                              "Sensitivity: %6% <br/>"
                              "Positive Predictive Value: %7% <br/>"
+                             "F1 Score: %10% <br/>"
+                             "</p>"
+                             "<p>"
+                             "<u>Speed:</u> <br/>"
+                             "Detection mode: %11 <br/>"
+                             "Mean detection time: %12 ms per image <br/>"
+                             "Maximum detection time: %13 ms <br/>"
+                             "Throughput: %14 images per second <br/>"
                              "</p>"
                              "<p>"
                              "In other words, if a face is detected as face, it will "
@@ -191,7 +215,12 @@ QString DetectionBenchmarker::result() const
                              .arg(totalImages).arg(faces).arg(pixelCoverage * 100, 0, 'f', 1)
                              .arg(specificity * 100, 0, 'f', 1).arg(falsePositiveRate * 100, 0, 'f', 1)
                              .arg(sensitivity * 100, 0, 'f', 1).arg(ppv * 100, 0, 'f', 1)
-                             .arg(specificityWarning).arg(sensitivityWarning);
+                             .arg(specificityWarning).arg(sensitivityWarning)
+                             .arg(f1Score * 100, 0, 'f', 1)
+                             .arg(d->twoStageDetection ? QString::fromUtf8("two-stage, reduced scale scan")
+                                                       : QString::fromUtf8("single stage, full scale scan"))
+                             .arg(meanTime, 0, 'f', 1).arg(maxDetectionTime)
+                             .arg(throughput, 0, 'f', 2);
 }
 
 // ----------------------------------------------------------------------------------------
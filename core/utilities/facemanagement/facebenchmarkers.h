@@ -24,6 +24,10 @@
 #ifndef DIGIKAM_FACE_BENCH_MARKERS_H
 #define DIGIKAM_FACE_BENCH_MARKERS_H
 
+// Qt includes
+
+#include <QElapsedTimer>
+
 // Local includes
 
 #include "facepipeline_p.h"
@@ -62,6 +66,10 @@ protected:
     int                          falseNegativeFaces;
     int                          falsePositiveFaces;
 
+    qint64                       totalDetectionTime;
+    qint64                       maxDetectionTime;
+    QElapsedTimer                elapsed;
+
     FacePipeline::Private* const d;
 };
 
@@ -217,6 +217,9 @@ void FacePipeline::plugFaceDetector()
 
     connect(d, SIGNAL(accuracyChanged(double)),
             d->detectionWorker, SLOT(setAccuracy(double)));
+
+    connect(d, SIGNAL(twoStageDetectionChanged(bool)),
+            d->detectionWorker, SLOT(setTwoStageDetection(bool)));
 }
 
 void FacePipeline::plugParallelFaceDetectors()
@@ -237,6 +240,9 @@ void FacePipeline::plugParallelFaceDetectors()
         connect(d, SIGNAL(accuracyChanged(double)),
                 worker, SLOT(setAccuracy(double)));
 
+        connect(d, SIGNAL(twoStageDetectionChanged(bool)),
+                worker, SLOT(setTwoStageDetection(bool)));
+
         d->parallelDetectors->add(worker);
     }
 }
@@ -526,4 +532,10 @@ void FacePipeline::setDetectionAccuracy(double value)
     emit d->accuracyChanged(value);
 }
 
+void FacePipeline::setTwoStageDetection(bool twoStage)
+{
+    d->twoStageDetection = twoStage;
+    emit d->twoStageDetectionChanged(twoStage);
+}
+
 } // namespace Digikam
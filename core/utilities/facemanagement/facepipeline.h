@@ -292,6 +292,11 @@ public Q_SLOTS:
 
     void setDetectionAccuracy(double accuracy);
 
+    /**
+     * Detect faces with a fast scan at reduced scale first, see FaceDetector parameters.
+     */
+    void setTwoStageDetection(bool twoStage);
+
 Q_SIGNALS:
 
     /// Emitted when processing is scheduled.
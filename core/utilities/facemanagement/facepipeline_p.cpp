@@ -74,6 +74,7 @@ FacePipeline::Private::Private(FacePipeline* const q)
     infosForFiltering      = 0;
     packagesOnTheRoad      = 0;
     maxPackagesOnTheRoad   = 50;
+    twoStageDetection      = false;
     totalPackagesAdded     = 0;
 }
 
@@ -59,10 +59,18 @@ class ScanStateFilter;
 class Q_DECL_HIDDEN FacePipelineExtendedPackage : public FacePipelinePackage,
                                                   public QSharedData
 {
+public:
+
+    explicit FacePipelineExtendedPackage()
+        : detectionTime(0)
+    {
+    }
+
 public:
 
     QString                                                           filePath;
     DImg                                                              detectionImage; // image scaled to about 0.5 Mpx
+    qint64                                                            detectionTime;  // in milliseconds, set by the detector
     typedef QExplicitlySharedDataPointer<FacePipelineExtendedPackage> Ptr;
 
 public:
@@ -138,6 +146,7 @@ public:
     int                                     infosForFiltering;
     int                                     packagesOnTheRoad;
     int                                     maxPackagesOnTheRoad;
+    bool                                    twoStageDetection;
     int                                     totalPackagesAdded;
 
     QList<FacePipelineExtendedPackage::Ptr> delayedPackages;
@@ -152,6 +161,7 @@ Q_SIGNALS:
     void startProcess(FacePipelineExtendedPackage::Ptr package);
 
     void accuracyChanged(double accuracy);
+    void twoStageDetectionChanged(bool twoStage);
     void thresholdChanged(double threshold);
 
 private:
@@ -72,6 +72,7 @@ public:
           configValueRecognizedMarkedFaces(QLatin1String("Recognize Marked Faces")),
           configAlreadyScannedHandling(QLatin1String("Already Scanned Handling")),
           configUseFullCpu(QLatin1String("Use Full CPU")),
+          configTwoStageDetection(QLatin1String("Two Stage Detection")),
           configSettingsVisible(QLatin1String("Settings Widget Visible")),
           configRecognizeAlgorithm(QLatin1String("Recognize Algorithm")) 
     {
@@ -84,6 +85,7 @@ public:
         tabWidget                  = 0;
         albumSelectors             = 0;
         accuracyInput              = 0;
+        twoStageButton             = 0;
         useFullCpuButton           = 0;
         retrainAllButton           = 0;
         recognizeBox               = 0;
@@ -102,6 +104,7 @@ public:
     AlbumSelectors*              albumSelectors;
 
     DIntNumInput*                accuracyInput;
+    QCheckBox*                   twoStageButton;
 
     QCheckBox*                   useFullCpuButton;
     QCheckBox*                   retrainAllButton;
@@ -115,6 +118,7 @@ public:
     const QString                configValueRecognizedMarkedFaces;
     const QString                configAlreadyScannedHandling;
     const QString                configUseFullCpu;
+    const QString                configTwoStageDetection;
     const QString                configSettingsVisible;
     const QString                configRecognizeAlgorithm;
 };
@@ -192,6 +196,7 @@ void FaceScanDialog::doLoadState()
     d->albumSelectors->loadState();
 
     d->useFullCpuButton->setChecked(group.readEntry(entryName(d->configUseFullCpu), false));
+    d->twoStageButton->setChecked(group.readEntry(entryName(d->configTwoStageDetection), false));
 
     RecognitionDatabase::RecognizeAlgorithm algo =
             (RecognitionDatabase::RecognizeAlgorithm)group.readEntry(entryName(d->configRecognizeAlgorithm),
@@ -251,6 +256,7 @@ void FaceScanDialog::doSaveState()
     d->albumSelectors->saveState();
 
     group.writeEntry(entryName(d->configUseFullCpu),         d->useFullCpuButton->isChecked());
+    group.writeEntry(entryName(d->configTwoStageDetection),  d->twoStageButton->isChecked());
     group.writeEntry(entryName(d->configSettingsVisible),    d->tabWidget->isVisible());
     group.writeEntry(entryName(d->configRecognizeAlgorithm), d->recognizeBox->itemData(d->recognizeBox->currentIndex()));
 }
@@ -335,11 +341,18 @@ void FaceScanDialog::setupUi()
                                        "Adjust speed versus accuracy: The higher the value, the more accurate the results "
                                        "will be, but it will take more time."));
 
-    parametersLayout->addWidget(detectionLabel,   0, 0, 1, 1);
-    parametersLayout->addWidget(d->accuracyInput, 1, 0, 1, 1);
-    parametersLayout->addWidget(accuracyLabel,    2, 0, 1, 1);
+    d->twoStageButton                   = new QCheckBox(parametersTab);
+    d->twoStageButton->setText(i18nc("@option:check", "Fast scan at reduced size first"));
+    d->twoStageButton->setToolTip(i18nc("@info:tooltip",
+                                        "Search faces on a small copy of the image first, then check the "
+                                        "found faces at full size. Much faster, but the smallest faces can be missed."));
+
+    parametersLayout->addWidget(detectionLabel,    0, 0, 1, 1);
+    parametersLayout->addWidget(d->accuracyInput,  1, 0, 1, 1);
+    parametersLayout->addWidget(accuracyLabel,     2, 0, 1, 1);
+    parametersLayout->addWidget(d->twoStageButton, 3, 0, 1, 1);
     parametersLayout->setColumnStretch(0, 10);
-    parametersLayout->setRowStretch(3, 10);
+    parametersLayout->setRowStretch(4, 10);
 
     d->tabWidget->addTab(parametersTab, i18nc("@title:tab", "Parameters"));
 
@@ -469,6 +482,8 @@ FaceScanSettings FaceScanDialog::settings() const
 
     settings.accuracy               = double(d->accuracyInput->value()) / 100;
 
+    settings.twoStageDetection      = d->twoStageButton->isChecked();
+
     settings.albums << d->albumSelectors->selectedAlbumsAndTags();
 
     settings.useFullCpu             = d->useFullCpuButton->isChecked();
@@ -62,6 +62,7 @@ public:
     {
         useFullCpu             = false;
         accuracy               = 80;
+        twoStageDetection      = false;
         task                   = Detect;
         alreadyScannedHandling = Skip;
         recognizeAlgorithm     = RecognitionDatabase::RecognizeAlgorithm::LBP;
@@ -73,6 +74,9 @@ public:
     // detection
     double                                  accuracy;
 
+    // fast scan at reduced scale, then locate and verify the candidates at full scale
+    bool                                    twoStageDetection;
+
     // albums to scan
     AlbumList                               albums;
 
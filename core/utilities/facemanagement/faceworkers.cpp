@@ -23,6 +23,12 @@
 
 #include "faceworkers.h"
 
+// Qt includes
+
+#include <QElapsedTimer>
+
+// KDE includes
+
 #include <ksharedconfig.h>
 #include <kconfiggroup.h>
 
@@ -40,8 +46,12 @@ DetectionWorker::DetectionWorker(FacePipeline::Private* const d)
 
 void DetectionWorker::process(FacePipelineExtendedPackage::Ptr package)
 {
+    QElapsedTimer timer;
+    timer.start();
+
     QImage detectionImage  = scaleForDetection(package->image);
     package->detectedFaces = detector.detectFaces(detectionImage, package->image.originalSize());
+    package->detectionTime = timer.elapsed();
 
     qCDebug(DIGIKAM_GENERAL_LOG) << "Found" << package->detectedFaces.size() << "faces in"
                                  << package->info.name() << package->image.size()
@@ -72,6 +82,11 @@ void DetectionWorker::setAccuracy(double accuracy)
     detector.setParameters(params);
 }
 
+void DetectionWorker::setTwoStageDetection(bool twoStage)
+{
+    detector.setParameter(QLatin1String("twostage"), twoStage);
+}
+
 // ----------------------------------------------------------------------------------------
 
 RecognitionWorker::RecognitionWorker(FacePipeline::Private* const d)
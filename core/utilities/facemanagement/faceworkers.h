@@ -50,6 +50,7 @@ public Q_SLOTS:
 
     void process(FacePipelineExtendedPackage::Ptr package);
     void setAccuracy(double value);
+    void setTwoStageDetection(bool twoStage);
 
 Q_SIGNALS:
 
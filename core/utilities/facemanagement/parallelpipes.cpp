@@ -31,7 +31,8 @@ namespace Digikam
 {
 
 ParallelPipes::ParallelPipes()
-    : m_currentIndex(0)
+    : m_currentIndex(0),
+      m_dispatchMode(ParallelWorkers::LeastLoaded)
 {
 }
 
@@ -75,6 +76,23 @@ void ParallelPipes::setPriority(QThread::Priority priority)
     }
 }
 
+void ParallelPipes::setDispatchMode(ParallelWorkers::DispatchMode mode)
+{
+    m_dispatchMode = mode;
+}
+
+QList<int> ParallelPipes::queueDepths() const
+{
+    QList<int> depths;
+
+    foreach (WorkerObject* const object, m_workers)
+    {
+        depths << object->pendingCalls();
+    }
+
+    return depths;
+}
+
 void ParallelPipes::add(WorkerObject* const worker)
 {
     QByteArray normalizedSignature = QMetaObject::normalizedSignature("process(FacePipelineExtendedPackage::Ptr)");
@@ -97,14 +115,11 @@ void ParallelPipes::add(WorkerObject* const worker)
 
 void ParallelPipes::process(FacePipelineExtendedPackage::Ptr package)
 {
-    // Here, we send the package to one of the workers, in turn
-    m_methods.at(m_currentIndex).invoke(m_workers.at(m_currentIndex), Qt::QueuedConnection,
-                                        Q_ARG(FacePipelineExtendedPackage::Ptr, package));
+    // Here, we send the package to one of the workers, the least busy one or in turn
+    int index = ParallelWorkers::nextWorker(m_workers, m_currentIndex, m_dispatchMode);
 
-    if (++m_currentIndex == m_workers.size())
-    {
-        m_currentIndex = 0;
-    }
+    m_workers.at(index)->dispatch(m_methods.at(index),
+                                  QList<QGenericArgument>() << Q_ARG(FacePipelineExtendedPackage::Ptr, package));
 }
 
 } // namespace Digikam
@@ -27,6 +27,7 @@
 // Local includes
 
 #include "facepipeline_p.h"
+#include "parallelworkers.h"
 
 namespace Digikam
 {
@@ -47,6 +48,12 @@ public:
     void add(WorkerObject* const worker);
     void setPriority(QThread::Priority priority);
 
+    /// Sets how packages are distributed over the workers. Default is ParallelWorkers::LeastLoaded.
+    void setDispatchMode(ParallelWorkers::DispatchMode mode);
+
+    /// Returns the number of packages queued to each worker, in the order the workers were added.
+    QList<int> queueDepths() const;
+
 public:
 
     QList<WorkerObject*> m_workers;
@@ -61,8 +68,9 @@ Q_SIGNALS:
 
 protected:
 
-    QList<QMetaMethod> m_methods;
-    int                m_currentIndex;
+    QList<QMetaMethod>            m_methods;
+    int                           m_currentIndex;
+    ParallelWorkers::DispatchMode m_dispatchMode;
 };
 
 } // namespace Digikam
@@ -203,6 +203,48 @@ void EditorCore::resetImage()
     d->image.reset();
 }
 
+DImg EditorCore::getImgPyramidLevel(int level) const
+{
+    level = qBound(0, level, (int)Private::maxPyramidLevel);
+
+    if (level == 0 || d->image.isNull())
+    {
+        return d->image;
+    }
+
+    // Image data can be replaced without going through setModified().
+    if (d->pyramidSource != d->image.bits())
+    {
+        d->resetPyramid();
+        d->pyramidSource = d->image.bits();
+    }
+
+    // Each level is scaled down from the previous one, which is much cheaper
+    // than scaling the full image each time.
+    while (d->pyramid.size() < level)
+    {
+        const DImg& src = d->pyramid.isEmpty() ? d->image : d->pyramid.last();
+        d->pyramid << src.smoothScale(qMax(1, (int)src.width()  / 2),
+                                      qMax(1, (int)src.height() / 2));
+    }
+
+    return d->pyramid.at(level - 1);
+}
+
+int EditorCore::pyramidLevelForSize(const QRect& rect, const QSize& size) const
+{
+    int level = 0;
+
+    while (level < Private::maxPyramidLevel                   &&
+           (rect.width()  >> (level + 1)) >= size.width()     &&
+           (rect.height() >> (level + 1)) >= size.height())
+    {
+        ++level;
+    }
+
+    return level;
+}
+
 void EditorCore::setICCSettings(const ICCSettingsContainer& cmSettings)
 {
     d->cmSettings = cmSettings;
@@ -493,6 +535,8 @@ void EditorCore::setHistoryIsBranch(bool isBranching)
 
 void EditorCore::setModified()
 {
+    d->resetPyramid();
+
     emit signalModified();
     emit signalUndoStateChanged();
 }
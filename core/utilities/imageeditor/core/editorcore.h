@@ -125,6 +125,18 @@ public:
     int     origHeight()      const;
     int     bytesDepth()      const;
 
+    /** Image pyramid of the current image, used for fast previews.
+     *  Level 0 is the image itself, level 1 is scaled to 1/2, level 2 to 1/4
+     *  and level 3 to 1/8. Levels are computed on demand and dropped when
+     *  the image is modified. The returned image may not be modified.
+     */
+    DImg    getImgPyramidLevel(int level) const;
+
+    /** Return the highest pyramid level where the region rect of the current image,
+     *  given in original image coordinates, is still at least as large as size.
+     */
+    int     pyramidLevelForSize(const QRect& rect, const QSize& size) const;
+
     /** Image transforms
      */
     void    rotate90();
@@ -91,6 +91,7 @@ public:
         zoom(1.0),
         displayingWidget(0),
         currentFileToSave(0),
+        pyramidSource(0),
         undoMan(0),
         expoSettings(0),
         thread(0)
@@ -103,6 +104,7 @@ public:
     void applyReversibleBuiltinFilter(const DImgBuiltinFilter& filter);
     void putImageData(uchar* const data, int w, int h, bool sixteenBit);
     void resetValues();
+    void resetPyramid();
     void saveNext();
     void loadCurrent();
     void load(const LoadingDescription& description);
@@ -135,6 +137,11 @@ public:
 
     DImg                       image;
     DImageHistory              resolvedInitialHistory;
+
+    /// Levels 1 to maxPyramidLevel of the image pyramid, built on demand.
+    QList<DImg>                pyramid;
+    const uchar*               pyramidSource;
+    static const int           maxPyramidLevel = 3;
     UndoManager*               undoMan;
 
     ICCSettingsContainer       cmSettings;
@@ -191,6 +198,13 @@ void EditorCore::Private::resetValues()
     selH                   = 0;
     resolvedInitialHistory = DImageHistory();
     undoMan->clear();
+    resetPyramid();
+}
+
+void EditorCore::Private::resetPyramid()
+{
+    pyramid.clear();
+    pyramidSource = 0;
 }
 
 void EditorCore::Private::saveNext()
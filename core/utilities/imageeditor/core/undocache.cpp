@@ -25,6 +25,10 @@
 
 #include "undocache.h"
 
+// C++ includes
+
+#include <cstring>
+
 // Qt includes
 
 #include <QApplication>
@@ -32,10 +36,15 @@
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
+#include <QFuture>
+#include <QMap>
+#include <QSharedPointer>
 #include <QStringList>
 #include <QStandardPaths>
 #include <QStorageInfo>
 #include <QMessageBox>
+#include <QThreadPool>
+#include <QtConcurrent>    // krazy:exclude=includes
 
 // KDE includes
 
@@ -44,29 +53,230 @@
 // Local includes
 
 #include "digikam_debug.h"
+#include "kmemoryinfo.h"
 
 namespace Digikam
 {
 
+namespace
+{
+
+/**
+ * The pixel buffer is split in blocks which are compressed independently,
+ * so that all cores can work on one undo level.
+ */
+const uint undoCacheBlockSize = 4 * 1024 * 1024;
+
+class Q_DECL_HIDDEN UndoBlockCompressor
+{
+public:
+
+    typedef QByteArray result_type;
+
+    QByteArray operator()(const QByteArray& block) const
+    {
+        // Use the fastest zlib level: undo data is short-lived,
+        // speed matters more than compression ratio.
+        return qCompress(block, 1);
+    }
+};
+
+class Q_DECL_HIDDEN UndoBlockUncompressor
+{
+public:
+
+    typedef QByteArray result_type;
+
+    QByteArray operator()(const QByteArray& block) const
+    {
+        return qUncompress(block);
+    }
+};
+
+/**
+ * Compress and write the image data to the cache file. Runs in the writer thread.
+ */
+bool writeCacheFile(const QString& path, const DImg& img, QSharedPointer<QAtomicInt> canceled)
+{
+    if (canceled->loadAcquire())
+    {
+        return false;
+    }
+
+    QFile file(path);
+
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        return false;
+    }
+
+    const char* const bits = (const char*)img.bits();
+    const uint numBytes    = img.numBytes();
+    QList<QByteArray> blocks;
+
+    for (uint offset = 0 ; offset < numBytes ; offset += undoCacheBlockSize)
+    {
+        // No deep copy, the image data is kept alive by img.
+        blocks << QByteArray::fromRawData(bits + offset, qMin(undoCacheBlockSize, numBytes - offset));
+    }
+
+    QList<QByteArray> compressed = QtConcurrent::blockingMapped(blocks, UndoBlockCompressor());
+
+    QDataStream ds(&file);
+    ds << img.width();
+    ds << img.height();
+    ds << numBytes;
+    ds << img.hasAlpha();
+    ds << img.sixteenBit();
+    ds << (quint32)compressed.size();
+
+    foreach (const QByteArray& block, compressed)
+    {
+        if (canceled->loadAcquire())
+        {
+            break;
+        }
+
+        ds << block;
+    }
+
+    if (canceled->loadAcquire() || ds.status() != QDataStream::Ok || file.error() != QFileDevice::NoError)
+    {
+        file.close();
+        file.remove();
+
+        return false;
+    }
+
+    file.close();
+
+    return true;
+}
+
+} // namespace
+
 class Q_DECL_HIDDEN UndoCache::Private
 {
 public:
 
     explicit Private()
     {
-        cacheError = false;
+        cacheError   = false;
+        ramCacheSize = 0;
+        writeCount   = 0;
+
+        // One writer: levels are written in order and do not compete for the disk.
+        writerPool.setMaxThreadCount(1);
+    }
+
+    /**
+     * Each write gets its own file: a canceled write still running in the background
+     * removes its file when it stops, and must not touch the file of a new write of the same level.
+     */
+    QString newCacheFile(int level)
+    {
+        return QString::fromUtf8("%1-%2-%3.bin").arg(cachePrefix).arg(level).arg(++writeCount);
+    }
+
+    /**
+     * Drop the oldest levels from the memory cache until it fits its budget.
+     */
+    void trimRamCache()
+    {
+        qint64 size = 0;
+
+        foreach (const DImg& img, ramCache)
+        {
+            size += img.numBytes();
+        }
+
+        while (!ramCache.isEmpty() && (ramCache.size() > maxRamLevels || size > ramCacheSize))
+        {
+            size -= ramCache.begin().value().numBytes();
+            ramCache.erase(ramCache.begin());
+        }
+    }
+
+    /**
+     * Wait for the background write of this level to finish.
+     */
+    bool waitForWrite(int level)
+    {
+        if (!pendingWrites.contains(level))
+        {
+            return true;
+        }
+
+        QFuture<bool> future = pendingWrites.take(level);
+        cancelFlags.remove(level);
+        future.waitForFinished();
+
+        if (!future.result())
+        {
+            qCWarning(DIGIKAM_GENERAL_LOG) << "Cannot write undo cache file for level" << level;
+        }
+
+        return future.result();
     }
 
-    QString cacheFile(int level) const
+    /**
+     * Abort the background write of this level without waiting for it.
+     * The writer removes the file when it stops.
+     */
+    void cancelWrite(int level)
     {
-        return QString::fromUtf8("%1-%2.bin").arg(cachePrefix).arg(level);
+        if (!pendingWrites.contains(level))
+        {
+            return;
+        }
+
+        cancelFlags.take(level)->storeRelease(1);
+        pendingWrites.remove(level);
     }
 
-    QString   cacheDir;
-    QString   cachePrefix;
-    QSet<int> cachedLevels;
+    /**
+     * Forget finished background writes.
+     */
+    void collectFinishedWrites()
+    {
+        foreach (int level, pendingWrites.keys())
+        {
+            if (pendingWrites.value(level).isFinished())
+            {
+                waitForWrite(level);
+            }
+        }
+    }
 
-    bool      cacheError;
+    void removeLevel(int level)
+    {
+        cancelWrite(level);
+        ramCache.remove(level);
+        QFile(cacheFiles.take(level)).remove();
+        cachedLevels.remove(level);
+    }
+
+public:
+
+    static const int                       maxRamLevels     = 3;
+
+    /// Maximum number of image copies waiting for the writer.
+    static const int                       maxPendingWrites = 2;
+
+    QString                                cacheDir;
+    QString                                cachePrefix;
+    QSet<int>                              cachedLevels;
+    QMap<int, QString>                     cacheFiles;
+    int                                    writeCount;
+
+    bool                                   cacheError;
+
+    QMap<int, DImg>                        ramCache;
+    qint64                                 ramCacheSize;
+
+    QMap<int, QFuture<bool> >              pendingWrites;
+    QMap<int, QSharedPointer<QAtomicInt> > cancelFlags;
+    QThreadPool                            writerPool;
 };
 
 UndoCache::UndoCache()
@@ -78,6 +288,19 @@ UndoCache::UndoCache()
                      .arg(d->cacheDir)
                      .arg(QCoreApplication::applicationPid());
 
+    // Keep the most recent levels in memory, using up to 1/8 of the physical memory.
+
+    KMemoryInfo memory = KMemoryInfo::currentInfo();
+
+    if (memory.isValid() == 1)
+    {
+        d->ramCacheSize = memory.bytes(KMemoryInfo::TotalRam) / 8;
+    }
+    else
+    {
+        d->ramCacheSize = 256 * 1024 * 1024;
+    }
+
     // remove any remnants
     QDir dir(d->cacheDir);
 
@@ -97,10 +320,11 @@ void UndoCache::clear()
 {
     foreach (int level, d->cachedLevels)
     {
-        QFile(d->cacheFile(level)).remove();
+        d->removeLevel(level);
     }
 
     d->cachedLevels.clear();
+    d->ramCache.clear();
 }
 
 void UndoCache::clearFrom(int fromLevel)
@@ -109,8 +333,7 @@ void UndoCache::clearFrom(int fromLevel)
     {
         if (level >= fromLevel)
         {
-            QFile(d->cacheFile(level)).remove();
-            d->cachedLevels.remove(level);
+            d->removeLevel(level);
         }
     }
 }
@@ -145,46 +368,66 @@ bool UndoCache::putData(int level, const DImg& img) const
         return false;
     }
 
-    QFile file(d->cacheFile(level));
-
-    if (file.exists() || !file.open(QIODevice::WriteOnly))
+    if (d->cachedLevels.contains(level))
     {
         return false;
     }
 
-    QDataStream ds(&file);
-    ds << img.width();
-    ds << img.height();
-    ds << img.numBytes();
-    ds << img.hasAlpha();
-    ds << img.sixteenBit();
+    d->collectFinishedWrites();
 
-    file.write((const char*)img.bits(), img.numBytes());
+    // Each pending write holds a full copy of the image: when the writer is behind,
+    // wait for the oldest write before taking a new copy.
 
-    if (file.error() != QFileDevice::NoError)
+    while (d->pendingWrites.size() >= Private::maxPendingWrites)
     {
-        file.close();
-        file.remove();
+        d->waitForWrite(d->pendingWrites.firstKey());
+    }
+
+    // The editor continues to work on the image buffer, take a deep copy.
+    // It is shared by the memory cache and the background writer.
+    DImg data = img.copy();
 
+    if (data.isNull())
+    {
         return false;
     }
 
-    d->cachedLevels << level;
+    d->ramCache.insert(level, data);
+    d->trimRamCache();
 
-    file.close();
+    QSharedPointer<QAtomicInt> canceled(new QAtomicInt(0));
+    QString cacheFile = d->newCacheFile(level);
+    d->cacheFiles.insert(level, cacheFile);
+    d->cancelFlags.insert(level, canceled);
+    d->pendingWrites.insert(level, QtConcurrent::run(&d->writerPool, writeCacheFile,
+                                                     cacheFile, data, canceled));
+
+    d->cachedLevels << level;
 
     return true;
 }
 
 DImg UndoCache::getData(int level) const
 {
-    uint w          = 0;
-    uint h          = 0;
-    uint numBytes   = 0;
-    bool hasAlpha   = false;
-    bool sixteenBit = false;
+    if (d->ramCache.contains(level))
+    {
+        // The caller may modify the returned image in place.
+        return d->ramCache.value(level).copy();
+    }
+
+    if (!d->cachedLevels.contains(level) || !d->waitForWrite(level))
+    {
+        return DImg();
+    }
+
+    uint    w          = 0;
+    uint    h          = 0;
+    uint    numBytes   = 0;
+    bool    hasAlpha   = false;
+    bool    sixteenBit = false;
+    quint32 blockCount = 0;
 
-    QFile file(d->cacheFile(level));
+    QFile file(d->cacheFiles.value(level));
 
     if (!file.open(QIODevice::ReadOnly))
     {
@@ -197,6 +440,7 @@ DImg UndoCache::getData(int level) const
     ds >> numBytes;
     ds >> hasAlpha;
     ds >> sixteenBit;
+    ds >> blockCount;
 
     if (ds.status() != QDataStream::Ok || ds.atEnd())
     {
@@ -216,16 +460,43 @@ DImg UndoCache::getData(int level) const
         return DImg();
     }
 
-    qint64 readBytes = file.read((char*)img.bits(), numBytes);
+    QList<QByteArray> blocks;
 
-    if (file.error() != QFileDevice::NoError || readBytes != numBytes)
+    for (quint32 i = 0 ; i < blockCount ; ++i)
     {
-        file.close();
+        QByteArray block;
+        ds >> block;
+        blocks << block;
+    }
+
+    file.close();
+
+    if (ds.status() != QDataStream::Ok)
+    {
+        qCDebug(DIGIKAM_GENERAL_LOG) << "The undo cache file is corrupt";
 
         return DImg();
     }
 
-    file.close();
+    QList<QByteArray> uncompressed = QtConcurrent::blockingMapped(blocks, UndoBlockUncompressor());
+    uchar* const bits              = img.bits();
+    uint offset                    = 0;
+
+    foreach (const QByteArray& block, uncompressed)
+    {
+        if (block.isEmpty() || (offset + (uint)block.size()) > numBytes)
+        {
+            return DImg();
+        }
+
+        memcpy(bits + offset, block.constData(), block.size());
+        offset += block.size();
+    }
+
+    if (offset != numBytes)
+    {
+        return DImg();
+    }
 
     return img;
 }
@@ -43,7 +43,7 @@ public:
     ~UndoCache();
 
     /**
-     * Delete all cache files
+     * Delete all cache files. Pending writes are canceled, without waiting for them.
      */
     void clear();
 
@@ -53,12 +53,16 @@ public:
     void clearFrom(int level);
 
     /**
-     * Write the image data into a cache file
+     * Write the image data into a cache file.
+     * The most recent levels are kept in memory. The cache file is compressed
+     * and written in a background thread, this method only takes a deep copy
+     * of the image data. If the writer is behind, it waits for the oldest pending write.
      */
     bool putData(int level, const DImg& img) const;
 
     /**
-     * Get the image data from a cache file
+     * Get the image data from the memory cache or from a cache file.
+     * If the cache file of this level is still being written, waits for it.
      */
     DImg getData(int level) const;
 
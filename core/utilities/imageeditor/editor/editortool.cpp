@@ -372,13 +372,25 @@ public:
 
     explicit Private()
       : delFilter(true),
+        progressivePreview(true),
+        coarsePass(false),
         currentRenderingMode(EditorToolThreaded::NoneRendering),
         threadedFilter(0),
         threadedAnalyser(0)
     {
     }
 
+    /** Number of pyramid levels below screen resolution used by the coarse preview pass.
+     */
+    static const int                  coarseProxyLevel = 2;
+
+    /** Regions smaller than this (in pixels) are rendered in one pass.
+     */
+    static const int                  progressiveMinPixels = 512 * 512;
+
     bool                              delFilter;
+    bool                              progressivePreview;
+    bool                              coarsePass;
 
     EditorToolThreaded::RenderingMode currentRenderingMode;
 
@@ -505,6 +517,7 @@ void EditorToolThreaded::slotResized()
 void EditorToolThreaded::slotAbort()
 {
     d->currentRenderingMode = EditorToolThreaded::NoneRendering;
+    setPreviewProxyLevel(0);
 
     if (analyser())
     {
@@ -544,6 +557,25 @@ void EditorToolThreaded::slotFilterFinished(bool success)
             {
                 qCDebug(DIGIKAM_GENERAL_LOG) << "Preview " << toolName() << " completed...";
                 setPreviewImage();
+
+                ImageRegionWidget* const view = dynamic_cast<ImageRegionWidget*>(toolView());
+
+                // Tools working on the full resolution region do not use the proxy.
+                if (d->coarsePass && view && view->previewProxyUsed())
+                {
+                    // Coarse preview is shown, now refine at screen resolution.
+                    setPreviewProxyLevel(0);
+
+                    if (d->delFilter && d->threadedFilter)
+                    {
+                        delete d->threadedFilter;
+                        d->threadedFilter = 0;
+                    }
+
+                    preparePreview();
+                    break;
+                }
+
                 slotAbort();
                 break;
             }
@@ -614,6 +646,7 @@ void EditorToolThreaded::slotOk()
 
     writeSettings();
 
+    setPreviewProxyLevel(0);
     d->currentRenderingMode = EditorToolThreaded::FinalRendering;
     qCDebug(DIGIKAM_GENERAL_LOG) << "Final " << toolName() << " started...";
 
@@ -638,6 +671,17 @@ void EditorToolThreaded::slotOk()
 
 void EditorToolThreaded::slotPreview()
 {
+    // A stale preview is in process: cancel it and start again with current settings.
+    // As in slotResized(), the new preview is queued after the finished signal of the canceled filter.
+    if (d->progressivePreview                                          &&
+        d->currentRenderingMode == EditorToolThreaded::PreviewRendering &&
+        filter())
+    {
+        filter()->cancelFilter();
+        QTimer::singleShot(0, this, SLOT(slotPreview()));
+        return;
+    }
+
     // Computation already in process.
     if (d->currentRenderingMode != EditorToolThreaded::NoneRendering)
     {
@@ -663,9 +707,33 @@ void EditorToolThreaded::slotPreview()
         d->threadedFilter = 0;
     }
 
+    ImageRegionWidget* const view = dynamic_cast<ImageRegionWidget*>(toolView());
+    QRect region                  = view ? view->getOriginalImageRegionToRender() : QRect();
+
+    if (d->progressivePreview && view && (region.width() * region.height()) > Private::progressiveMinPixels)
+    {
+        setPreviewProxyLevel(Private::coarseProxyLevel);
+    }
+
     preparePreview();
 }
 
+void EditorToolThreaded::setProgressivePreview(bool b)
+{
+    d->progressivePreview = b;
+}
+
+void EditorToolThreaded::setPreviewProxyLevel(int level)
+{
+    d->coarsePass                 = (level > 0);
+    ImageRegionWidget* const view = dynamic_cast<ImageRegionWidget*>(toolView());
+
+    if (view)
+    {
+        view->setPreviewProxyLevel(level);
+    }
+}
+
 void EditorToolThreaded::slotCancel()
 {
     writeSettings();
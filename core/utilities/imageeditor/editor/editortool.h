@@ -174,6 +174,14 @@ protected:
      */
     void deleteFilterInstance(bool b = true);
 
+    /** If true (default), tools using an ImageRegionWidget render the preview in two passes:
+     *  a coarse pass on a 1/4 scaled region image taken from the editor image pyramid,
+     *  then the refined pass at screen resolution. Preview requests while rendering
+     *  cancel the stale rendering. Set to false for tools whose result cannot be
+     *  approximated at a lower resolution.
+     */
+    void setProgressivePreview(bool b);
+
     virtual void preparePreview()    {};
     virtual void prepareFinal()      {};
     virtual void setPreviewImage()   {};
@@ -206,6 +214,10 @@ private Q_SLOTS:
 
     void slotResized();
 
+private:
+
+    void setPreviewProxyLevel(int level);
+
 private:
 
     class Private;
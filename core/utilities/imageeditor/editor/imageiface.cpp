@@ -141,7 +141,17 @@ uchar* ImageIface::Private::previewImageData()
         QSize sz(im->width(), im->height());
         sz.scale(constrainWidth, constrainHeight, Qt::KeepAspectRatio);
 
-        previewImage       = im->smoothScale(sz.width(), sz.height());
+        if (previewType == FullImage)
+        {
+            // Scale down from the image pyramid instead of the full resolution image.
+            int level          = core->pyramidLevelForSize(QRect(0, 0, im->width(), im->height()), sz);
+            previewImage       = core->getImgPyramidLevel(level).smoothScale(sz.width(), sz.height());
+        }
+        else
+        {
+            previewImage       = im->smoothScale(sz.width(), sz.height());
+        }
+
         previewWidth       = previewImage.width();
         previewHeight      = previewImage.height();
 
@@ -248,6 +258,33 @@ DImg ImageIface::preview() const
     return DImg(d->previewWidth, d->previewHeight, previewSixteenBit(), previewHasAlpha(), data);
 }
 
+DImg ImageIface::originalRegion(const QRect& rect, const QSize& size) const
+{
+    QRect region = rect.intersected(QRect(0, 0, d->core->origWidth(), d->core->origHeight()));
+
+    if (region.isEmpty() || size.isEmpty())
+    {
+        return DImg();
+    }
+
+    int level    = d->core->pyramidLevelForSize(region, size);
+    DImg src     = d->core->getImgPyramidLevel(level);
+
+    if (src.isNull())
+    {
+        return DImg();
+    }
+
+    QRect scaled = QRect(region.x() >> level, region.y() >> level,
+                         qMax(1, region.width() >> level), qMax(1, region.height() >> level));
+    scaled       = scaled.intersected(QRect(0, 0, src.width(), src.height()));
+
+    DImg image   = src.copy(scaled);
+    image.resize(size.width(), size.height());
+
+    return image;
+}
+
 DImg* ImageIface::original() const
 {
     return d->core->getImg();
@@ -97,6 +97,13 @@ public:
      */
     DImg  selection()                       const;
 
+    /** Return the region rect of the original image, given in original image coordinates,
+     *  scaled to size. The data is taken from the smallest level of the image pyramid
+     *  (1/2, 1/4 or 1/8) which is still at least as large as size, which is much faster
+     *  than scaling down the full resolution original image.
+     */
+    DImg  originalRegion(const QRect& rect, const QSize& size) const;
+
     /** Get colors from original, (unchanged) preview
      *  or target preview (set by setPreviewImage) image.
      */
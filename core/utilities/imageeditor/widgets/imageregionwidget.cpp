@@ -42,6 +42,7 @@
 
 #include "digikam_debug.h"
 #include "imageregionitem.h"
+#include "imageiface.h"
 #include "previewtoolbar.h"
 #include "previewlayout.h"
 #include "dimgitems_p.h"
@@ -58,6 +59,8 @@ public:
       : capturePtMode(false),
         renderingPreviewMode(PreviewToolBar::PreviewBothImagesVertCont),
         oldRenderingPreviewMode(PreviewToolBar::PreviewBothImagesVertCont),
+        proxyLevel(0),
+        proxyUsed(false),
         delay(0),
         item(0)
     {
@@ -67,6 +70,8 @@ public:
 
     int              renderingPreviewMode;
     int              oldRenderingPreviewMode;
+    int              proxyLevel;
+    bool             proxyUsed;
 
     QPolygon         hightlightPoints;
 
@@ -186,17 +191,55 @@ DImg ImageRegionWidget::getOriginalImage() const
 
 DImg ImageRegionWidget::getOriginalRegionImage(bool useDownscaledImage) const
 {
+    if (useDownscaledImage)
+    {
+        d_ptr->proxyUsed = (d_ptr->proxyLevel > 0);
+
+        // Take the data from the image pyramid of the editor instead of
+        // scaling down the full resolution region.
+
+        QRect r = d_ptr->item->getImageRegion();
+        QSize size(qMax(1, r.width()  >> d_ptr->proxyLevel),
+                   qMax(1, r.height() >> d_ptr->proxyLevel));
+
+        ImageIface iface;
+        DImg image = iface.originalRegion(getOriginalImageRegionToRender(), size);
+
+        if (!image.isNull())
+        {
+            image.setIccProfile(d_ptr->item->image().getIccProfile());
+            return image;
+        }
+    }
+
     DImg image = d_ptr->item->image().copy(getOriginalImageRegionToRender());
 
     if (useDownscaledImage)
     {
         QRect r = d_ptr->item->getImageRegion();
-        image.resize(r.width(), r.height());
+        image.resize(qMax(1, r.width()  >> d_ptr->proxyLevel),
+                     qMax(1, r.height() >> d_ptr->proxyLevel));
     }
 
     return (image);
 }
 
+void ImageRegionWidget::setPreviewProxyLevel(int level)
+{
+    d_ptr->proxyLevel = qMax(0, level);
+    d_ptr->proxyUsed  = false;
+}
+
+int ImageRegionWidget::previewProxyLevel() const
+{
+    return d_ptr->proxyLevel;
+}
+
+bool ImageRegionWidget::previewProxyUsed() const
+{
+    return d_ptr->proxyUsed;
+}
+
 void ImageRegionWidget::slotOriginalImageRegionChangedDelayed()
 {
     viewport()->update();
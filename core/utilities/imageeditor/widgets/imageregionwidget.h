@@ -67,6 +67,19 @@ public:
      */
     DImg   getOriginalRegionImage(bool useDownscaledImage = false) const;
 
+    /** Set the proxy level used by getOriginalRegionImage() for downscaled images.
+        With level n > 0, the region image is scaled to 1/2^n of the screen resolution.
+        This is used by threaded tools to render a fast, coarse preview before
+        the preview at screen resolution. Default is 0.
+     */
+    void   setPreviewProxyLevel(int level);
+    int    previewProxyLevel() const;
+
+    /** Return true if a region image was rendered at a proxy level > 0
+        since the last call of setPreviewProxyLevel().
+     */
+    bool   previewProxyUsed()  const;
+
     DImg   getOriginalImage() const;
 
     void   setPreviewImage(const DImg& img);
@@ -39,6 +39,8 @@
 #include <QDir>
 #include <QMessageBox>
 #include <QProcess>
+#include <QFuture>
+#include <QtConcurrent>    // krazy:exclude=includes
 
 // KDE includes
 
@@ -53,8 +55,12 @@
 #include "templatemanager.h"
 #include "gpcamera.h"
 #include "umscamera.h"
+#include "camerathumbsstore.h"
 #include "jpegutils.h"
 #include "dfileoperations.h"
+#include "dimg.h"
+#include "itemscanprefetch.h"
+#include "thumbnailloadthread.h"
 
 namespace Digikam
 {
@@ -383,6 +389,27 @@ void CameraController::run()
             else if (!d->cmdThumbs.isEmpty())
             {
                 command = d->cmdThumbs.takeLast();
+
+                // Mass storage thumbnails are loaded in parallel: merge the pending
+                // requests of the same size to have enough items for all the cores.
+
+                if (cameraDriverType() == DKCamera::UMSDriver)
+                {
+                    QList<QVariant> list = command->map[QLatin1String("list")].toList();
+                    QVariant thumbSize   = command->map[QLatin1String("thumbSize")];
+
+                    while (!d->cmdThumbs.isEmpty()                                             &&
+                           (list.count() < QThread::idealThreadCount())                        &&
+                           (d->cmdThumbs.last()->map[QLatin1String("thumbSize")] == thumbSize))
+                    {
+                        CameraCommand* const next = d->cmdThumbs.takeLast();
+                        list                     += next->map[QLatin1String("list")].toList();
+                        delete next;
+                    }
+
+                    command->map.insert(QLatin1String("list"), QVariant(list));
+                }
+
                 emit signalBusy(false);
             }
             else
@@ -532,25 +559,59 @@ void CameraController::executeCommand(CameraCommand* const cmd)
         {
             QList<QVariant> list = cmd->map[QLatin1String("list")].toList();
             int thumbSize        = cmd->map[QLatin1String("thumbSize")].toInt();
+            QByteArray cameraId  = cameraMD5ID();
+            bool parallel        = (cameraDriverType() == DKCamera::UMSDriver);
+
+            QList<QStringList>     items;
+            QList<QFuture<QImage> > tasks;
 
             for (QList<QVariant>::const_iterator it = list.constBegin(); it != list.constEnd(); ++it)
+            {
+                QStringList item = (*it).toStringList();
+
+                // The file size and date identify the thumbnail stored in the database.
+
+                QString identifier;
+
+                if (item.count() >= 4)
+                {
+                    identifier = CameraThumbsStore::identifier(cameraId, item.at(0), item.at(1), item.at(2).toLongLong(),
+                                                               QDateTime::fromMSecsSinceEpoch(item.at(3).toLongLong()));
+                }
+
+                item.insert(2, identifier);
+                items << item;
+
+                if (parallel)
+                {
+                    tasks << QtConcurrent::run(this,
+                                               &CameraController::fetchThumbnail,
+                                               item.at(0),
+                                               item.at(1),
+                                               identifier,
+                                               thumbSize);
+                }
+            }
+
+            for (int i = 0 ; i < items.count() ; ++i)
             {
                 if (d->canceled)
                 {
                     break;
                 }
 
-                QString folder = (*it).toStringList().at(0);
-                QString file   = (*it).toStringList().at(1);
+                QString folder = items.at(i).at(0);
+                QString file   = items.at(i).at(1);
 
                 CamItemInfo info;
                 info.folder = folder;
-                info.name = file;
-                QImage thumbnail;
+                info.name   = file;
 
-                if (d->camera->getThumbnail(folder, file, thumbnail))
+                QImage thumbnail = parallel ? tasks[i].result()
+                                            : fetchThumbnail(folder, file, items.at(i).at(2), thumbSize);
+
+                if (!thumbnail.isNull())
                 {
-                    thumbnail = thumbnail.scaled(thumbSize, thumbSize, Qt::KeepAspectRatio);
                     emit signalThumbInfo(folder, file, info, thumbnail);
                 }
                 else
@@ -560,6 +621,13 @@ void CameraController::executeCommand(CameraCommand* const cmd)
                 }
             }
 
+            // The pending tasks return quickly once canceled.
+
+            foreach (QFuture<QImage> task, tasks)
+            {
+                task.waitForFinished();
+            }
+
             break;
         }
 
@@ -612,7 +680,8 @@ void CameraController::executeCommand(CameraCommand* const cmd)
 
             qCDebug(DIGIKAM_IMPORTUI_LOG) << "Downloading: " << file << " using " << temp;
 
-            bool result  = d->camera->downloadItem(folder, file, temp);
+            bool result        = d->camera->downloadItem(folder, file, temp);
+            QString downloaded = temp;
 
             if (!result)
             {
@@ -682,6 +751,9 @@ void CameraController::executeCommand(CameraCommand* const cmd)
                 if (applyChanges)
                 {
                     metadata.applyChanges();
+
+                    // The data read while downloading do not match the file anymore.
+                    ItemScanPrefetch::remove(temp);
                 }
 
                 // Convert JPEG file to lossless format if wanted,
@@ -752,6 +824,11 @@ void CameraController::executeCommand(CameraCommand* const cmd)
                 }
             }
 
+            if (temp != downloaded)
+            {
+                ItemScanPrefetch::remove(downloaded);
+            }
+
             // Now we need to move from temp file to destination file.
             // This possibly involves UI operation, do it from main thread
             emit signalInternalCheckRename(folder, file, dest, temp, script);
@@ -846,7 +923,8 @@ void CameraController::slotCheckRename(const QString& folder, const QString& fil
                                        const QString& script)
 {
     // this is the direct continuation of executeCommand, case CameraCommand::cam_download
-    QString dest = destination;
+    QString dest              = destination;
+    ItemScanPrefetch prefetch = ItemScanPrefetch::take(temp);
     QFileInfo info(dest);
 
     if (info.exists() && d->conflictRule == SetupCamera::SKIPFILE)
@@ -905,6 +983,26 @@ void CameraController::slotCheckRename(const QString& folder, const QString& fil
     else
     {
         qCDebug(DIGIKAM_IMPORTUI_LOG) << "Rename done, emitting downloaded signals:" << file << " info.filename: " << info.fileName();
+
+        // Hand the data read while downloading over to the collection scan of the destination file.
+        if (!prefetch.isNull())
+        {
+            if (!prefetch.preview.isNull())
+            {
+                DImg preview(prefetch.preview);
+                DMetadata meta;
+
+                if (meta.loadFromData(prefetch.metadataData))
+                {
+                    preview.setMetadata(meta.data());
+                }
+
+                ThumbnailLoadThread::storeThumbnail(dest, preview);
+                prefetch.preview = QImage();
+            }
+
+            ItemScanPrefetch::record(dest, prefetch);
+        }
         // TODO why two signals??
         emit signalDownloaded(folder, file, CamItemInfo::DownloadedYes);
         emit signalDownloadComplete(folder, file, info.path(), info.fileName());
@@ -1074,6 +1172,37 @@ bool CameraController::queueIsEmpty() const
     return (d->commands.isEmpty() && d->cmdThumbs.isEmpty());
 }
 
+QImage CameraController::fetchThumbnail(const QString& folder, const QString& file,
+                                        const QString& identifier, int thumbSize)
+{
+    QImage thumbnail;
+
+    if (d->canceled)
+    {
+        return thumbnail;
+    }
+
+    // A stored thumbnail is only used if it is large enough for the requested size.
+
+    if (CameraThumbsStore::load(identifier, thumbnail) &&
+        (qMax(thumbnail.width(), thumbnail.height()) >= thumbSize))
+    {
+        return thumbnail.scaled(thumbSize, thumbSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    }
+
+    thumbnail = QImage();
+
+    if (!d->camera->getThumbnail(folder, file, thumbnail) || thumbnail.isNull())
+    {
+        return QImage();
+    }
+
+    thumbnail = thumbnail.scaled(thumbSize, thumbSize, Qt::KeepAspectRatio);
+    CameraThumbsStore::store(identifier, thumbnail);
+
+    return thumbnail;
+}
+
 void CameraController::slotConnect()
 {
     d->canceled              = false;
@@ -1118,7 +1247,14 @@ void CameraController::getThumbsInfo(const CamItemInfoList& list, int thumbSize)
 
     foreach(CamItemInfo info, list)
     {
-        itemsList.append(QStringList() << info.folder << info.name);
+        QStringList item = QStringList() << info.folder << info.name;
+
+        if (info.ctime.isValid())
+        {
+            item << QString::number(info.size) << QString::number(info.ctime.toMSecsSinceEpoch());
+        }
+
+        itemsList.append(item);
     }
 
     cmd->map.insert(QLatin1String("list"),      QVariant(itemsList));
@@ -31,6 +31,7 @@
 #include <QThread>
 #include <QString>
 #include <QFileInfo>
+#include <QImage>
 
 // Local includes
 
@@ -153,6 +154,12 @@ private:
     void addCommand(CameraCommand* const cmd);
     bool queueIsEmpty() const;
 
+    /** Return the thumbnail of a camera item, from the thumbnails database if it was
+     *  stored before, else from the camera. Return a null image if it cannot be loaded.
+     */
+    QImage fetchThumbnail(const QString& folder, const QString& file,
+                          const QString& identifier, int thumbSize);
+
 private:
 
     class Private;
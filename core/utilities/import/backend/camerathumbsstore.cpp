@@ -0,0 +1,120 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : digital camera thumbnails stored in the thumbnails database
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "camerathumbsstore.h"
+
+// Qt includes
+
+#include <QVariant>
+
+// Local includes
+
+#include "digikam_debug.h"
+#include "pgfutils.h"
+#include "thumbsdb.h"
+#include "thumbsdbaccess.h"
+
+namespace Digikam
+{
+
+QString CameraThumbsStore::identifier(const QByteArray& cameraId, const QString& folder, const QString& file,
+                                      qint64 size, const QDateTime& date)
+{
+    if (cameraId.isEmpty() || (size <= 0) || !date.isValid())
+    {
+        return QString();
+    }
+
+    // Not built with arg(): the folder and file names can hold place markers.
+
+    return identifierPrefix()                                   +
+           QString::fromLatin1(cameraId)                        +
+           folder + QLatin1Char('/') + file                     +
+           QLatin1String("?size=") + QString::number(size)      +
+           QLatin1String("&date=") + QString::number(date.toMSecsSinceEpoch());
+}
+
+QString CameraThumbsStore::identifierPrefix()
+{
+    return QLatin1String("camera:");
+}
+
+bool CameraThumbsStore::load(const QString& identifier, QImage& thumbnail)
+{
+    if (identifier.isNull() || !ThumbsDbAccess::isInitialized())
+    {
+        return false;
+    }
+
+    ThumbsDbInfo dbInfo = ThumbsDbAccess().db()->findByCustomIdentifier(identifier);
+
+    if ((dbInfo.id == -1) || (dbInfo.type != DatabaseThumbnail::PGF))
+    {
+        return false;
+    }
+
+    if (!PGFUtils::readPGFImageData(dbInfo.data, thumbnail))
+    {
+        qCWarning(DIGIKAM_IMPORTUI_LOG) << "Cannot load PGF camera thumb from DB for" << identifier;
+        return false;
+    }
+
+    return !thumbnail.isNull();
+}
+
+void CameraThumbsStore::store(const QString& identifier, const QImage& thumbnail)
+{
+    if (identifier.isNull() || thumbnail.isNull() || !ThumbsDbAccess::isInitialized())
+    {
+        return;
+    }
+
+    ThumbsDbInfo dbInfo;
+    dbInfo.type             = DatabaseThumbnail::PGF;
+    dbInfo.modificationDate = QDateTime::currentDateTime();
+
+    // NOTE: same PGF compression level as the collection thumbnails, see bug #233094.
+    if (!PGFUtils::writePGFImageData(thumbnail, dbInfo.data, 4))
+    {
+        qCWarning(DIGIKAM_IMPORTUI_LOG) << "Cannot save PGF camera thumb in DB for" << identifier;
+        return;
+    }
+
+    ThumbsDbAccess access;
+    dbInfo.id = access.db()->findByCustomIdentifier(identifier).id;
+
+    if (dbInfo.id != -1)
+    {
+        access.db()->replaceThumbnail(dbInfo);
+        return;
+    }
+
+    QVariant id;
+
+    if (access.db()->insertThumbnail(dbInfo, &id) == BdEngineBackend::NoErrors)
+    {
+        access.db()->insertCustomIdentifier(identifier, id.toInt());
+    }
+}
+
+} // namespace Digikam
@@ -0,0 +1,67 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : digital camera thumbnails stored in the thumbnails database
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_CAMERA_THUMBS_STORE_H
+#define DIGIKAM_CAMERA_THUMBS_STORE_H
+
+// Qt includes
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QImage>
+#include <QString>
+
+namespace Digikam
+{
+
+/** The thumbnails of the camera items are kept in the thumbnails database between
+ *  sessions, PGF encoded as the thumbnails of the collection items. An item is
+ *  identified by the camera MD5 id and the name, size and date of the file, so a
+ *  file changed on the device gets a new thumbnail. All methods are thread-safe.
+ */
+class CameraThumbsStore
+{
+public:
+
+    /** Return the identifier of the thumbnail of a camera item,
+     *  or a null string if the item cannot be identified reliably.
+     */
+    static QString identifier(const QByteArray& cameraId, const QString& folder, const QString& file,
+                              qint64 size, const QDateTime& date);
+
+    /** Return the prefix of all the camera item identifiers.
+     */
+    static QString identifierPrefix();
+
+    /** Load the thumbnail stored for the identifier. Return false if there is none.
+     */
+    static bool load(const QString& identifier, QImage& thumbnail);
+
+    /** Store the thumbnail for the identifier, replacing a former one.
+     */
+    static void store(const QString& identifier, const QImage& thumbnail);
+};
+
+} // namespace Digikam
+
+#endif // DIGIKAM_CAMERA_THUMBS_STORE_H
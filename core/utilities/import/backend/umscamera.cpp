@@ -40,10 +40,13 @@ extern "C"
 #include <QFile>
 #include <QFileInfo>
 #include <QMatrix>
+#include <QMimeDatabase>
+#include <QMimeType>
 #include <QStringList>
 #include <QTextDocument>
 #include <QtGlobal>
 #include <QCryptographicHash>
+#include <QScopedArrayPointer>
 #include <qplatformdefs.h>
 
 // KDE includes
@@ -64,6 +67,9 @@ extern "C"
 #include "dimg.h"
 #include "dmetadata.h"
 #include "itemscanner.h"
+#include "itemscanprefetch.h"
+#include "metaengine_previews.h"
+#include "thumbnailloadthread.h"
 
 namespace Digikam
 {
@@ -270,7 +276,8 @@ void UMSCamera::getItemInfo(const QString& folder, const QString& itemName, CamI
 
 bool UMSCamera::getThumbnail(const QString& folder, const QString& itemName, QImage& thumbnail)
 {
-    m_cancel     = false;
+    // m_cancel is not reset here: the thumbnails are loaded in parallel with other commands.
+
     QString path = folder + QLatin1Char('/') + itemName;
 
     // Try to get preview from Exif data (good quality). Can work with Raw files
@@ -384,31 +391,28 @@ bool UMSCamera::downloadItem(const QString& folder, const QString& itemName, con
     QFile sFile(src);
     QFile dFile(dest);
 
-    if (!sFile.open(QIODevice::ReadOnly))
+    if (!sFile.open(QIODevice::ReadOnly | QIODevice::Unbuffered))
     {
         qCWarning(DIGIKAM_IMPORTUI_LOG) << "Failed to open source file for reading: " << src;
         return false;
     }
 
-    if (!dFile.open(QIODevice::WriteOnly))
+    // The destination is read back for the end of the unique hash.
+    if (!dFile.open(QIODevice::ReadWrite | QIODevice::Truncate | QIODevice::Unbuffered))
     {
         sFile.close();
         qCWarning(DIGIKAM_IMPORTUI_LOG) << "Failed to open destination file for writing: " << dest;
         return false;
     }
 
-    const int MAX_IPC_SIZE = (1024 * 32);
-    char      buffer[MAX_IPC_SIZE];
-    qint64    len;
+    QByteArray head;
+    QByteArray tail;
 
-    while (((len = sFile.read(buffer, MAX_IPC_SIZE)) != 0) && !m_cancel)
+    if (!copyFileData(sFile, dFile, head, tail))
     {
-        if ((len == -1) || (dFile.write(buffer, (quint64)len) != len))
-        {
-            sFile.close();
-            dFile.close();
-            return false;
-        }
+        sFile.close();
+        dFile.close();
+        return false;
     }
 
     sFile.close();
@@ -427,9 +431,146 @@ bool UMSCamera::downloadItem(const QString& folder, const QString& itemName, con
         ::utime(QFile::encodeName(dest).constData(), &ut);
     }
 
+    recordScanPrefetch(dest, head, tail);
+
     return true;
 }
 
+bool UMSCamera::copyFileData(QFile& sFile, QFile& dFile, QByteArray& head, QByteArray& tail)
+{
+    // The head holds the metadata of most files and the beginning of the unique hash.
+    const qint64 headSize = 512 * 1024;
+    const qint64 hashSize = 100 * 1024;
+    const qint64 size     = sFile.size();
+
+    head = sFile.read(qMin(size, headSize));
+
+    if ((head.size() != qMin(size, headSize)) || (dFile.write(head) != head.size()))
+    {
+        return false;
+    }
+
+    qint64 copied = head.size();
+
+#if defined(Q_OS_LINUX) && defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 27)))
+
+    // Let the kernel copy the rest of the file without passing it through user space.
+    // This fails between file systems with old kernels, the buffered copy takes over then.
+
+    const qint64 chunkSize = 8 * 1024 * 1024;
+    loff_t inOffset        = copied;
+    loff_t outOffset       = copied;
+
+    while ((copied < size) && !m_cancel)
+    {
+        ssize_t len = ::copy_file_range(sFile.handle(), &inOffset,
+                                        dFile.handle(), &outOffset,
+                                        (size_t)qMin(size - copied, chunkSize), 0);
+
+        if (len <= 0)
+        {
+            break;
+        }
+
+        copied += len;
+    }
+
+#endif
+
+    if ((copied < size) && !m_cancel)
+    {
+        const qint64 bufferSize = 4 * 1024 * 1024;
+        QScopedArrayPointer<char> buffer(new char[bufferSize]);
+
+        if (!sFile.seek(copied) || !dFile.seek(copied))
+        {
+            return false;
+        }
+
+        while ((copied < size) && !m_cancel)
+        {
+            qint64 len = sFile.read(buffer.data(), qMin(size - copied, bufferSize));
+
+            if ((len <= 0) || (dFile.write(buffer.data(), len) != len))
+            {
+                return false;
+            }
+
+            copied += len;
+        }
+    }
+
+    if (m_cancel)
+    {
+        return false;
+    }
+
+    // The end of the unique hash. Read back from the destination file, still in the system cache.
+
+    const qint64 tailSize = qMin(size, hashSize);
+
+    if (size <= head.size())
+    {
+        tail = head.right(tailSize);
+    }
+    else if (dFile.seek(size - tailSize))
+    {
+        tail = dFile.read(tailSize);
+    }
+
+    if (tail.size() != tailSize)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void UMSCamera::recordScanPrefetch(const QString& dest, const QByteArray& head, const QByteArray& tail)
+{
+    const int hashSize = 100 * 1024;
+    QFileInfo info(dest);
+
+    ItemScanPrefetch prefetch;
+    prefetch.fileSize         = info.size();
+    prefetch.modificationDate = info.lastModified();
+    prefetch.uniqueHash       = QString::fromUtf8(DImg::getUniqueHashV2(head.left(hashSize), tail));
+
+    // The metadata can be parsed from memory if the head holds the whole file, or if it is a JPEG file:
+    // Exiv2 reads the JPEG segments up to the start of scan, and fails if the head ends before.
+    // RAW files only get the unique hash: their IFDs, maker notes and previews can be anywhere
+    // in the file, the scan reads them from the destination file, which is still in the system cache.
+    // Video and audio files are never parsed here, the scan reads them with FFmpeg.
+
+    QByteArray metadataData;
+    QString    mimeType = QMimeDatabase().mimeTypeForFile(dest).name();
+
+    if (mimeType.startsWith(QLatin1String("image/")) &&
+        ((head.size() == info.size()) || (mimeType == QLatin1String("image/jpeg"))))
+    {
+        metadataData = head;
+    }
+
+    DMetadata meta;
+
+    if (!metadataData.isEmpty() && meta.loadFromData(metadataData))
+    {
+        prefetch.metadataData = metadataData;
+
+        // An embedded preview large enough for the thumbnail spares decoding the image later.
+
+        MetaEnginePreviews previews(head);
+
+        if (!previews.isEmpty() &&
+            (qMax(previews.width(), previews.height()) >= ThumbnailLoadThread::maximumThumbnailSize()))
+        {
+            prefetch.preview = previews.image();
+        }
+    }
+
+    ItemScanPrefetch::record(dest, prefetch);
+}
+
 bool UMSCamera::setLockItem(const QString& folder, const QString& itemName, bool lock)
 {
     QString src = folder + QLatin1Char('/') + itemName;
@@ -27,6 +27,8 @@
 
 // Qt includes
 
+#include <QByteArray>
+#include <QFile>
 #include <QStringList>
 
 // Local includes
@@ -83,6 +85,16 @@ private:
      */
     void getUUIDFromSolid();
 
+    /** Copy the content of the source file to the destination file. Return the beginning
+        of the file in head and the end of the unique hash data in tail.
+     */
+    bool copyFileData(QFile& sFile, QFile& dFile, QByteArray& head, QByteArray& tail);
+
+    /** Record the unique hash, the metadata and the embedded preview of the downloaded file,
+        read from the data of the copy, for the collection scan of the file.
+     */
+    void recordScanPrefetch(const QString& dest, const QByteArray& head, const QByteArray& tail);
+
 private:
 
     bool m_cancel;
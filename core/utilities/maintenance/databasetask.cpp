@@ -30,6 +30,7 @@
 // Local includes
 
 #include "digikam_debug.h"
+#include "camerathumbsstore.h"
 #include "iteminfo.h"
 #include "thumbsdb.h"
 #include "thumbsdbaccess.h"
@@ -290,6 +291,10 @@ void DatabaseTask::run()
 
             QSet<int> thumbIds = ThumbsDbAccess().db()->findAll().toSet();
 
+            // The thumbnails of the camera items are not referenced by the core db, keep them.
+
+            thumbIds.subtract(ThumbsDbAccess().db()->findByCustomIdentifierPrefix(CameraThumbsStore::identifierPrefix()).toSet());
+
             FaceTagsEditor editor;
 
             foreach (const qlonglong& item, coredbItems)
@@ -137,6 +137,7 @@ FacesDetector::FacesDetector(const FaceScanSettings& settings, ProgressItem* con
         }
 
         d->pipeline.plugDetectionBenchmarker();
+        d->pipeline.setTwoStageDetection(settings.twoStageDetection);
         d->pipeline.construct();
     }
     else if (settings.task == FaceScanSettings::BenchmarkRecognition)
@@ -191,6 +192,7 @@ FacesDetector::FacesDetector(const FaceScanSettings& settings, ProgressItem* con
 
         d->pipeline.plugDatabaseWriter(writeMode);
         d->pipeline.setDetectionAccuracy(settings.accuracy);
+        d->pipeline.setTwoStageDetection(settings.twoStageDetection);
         d->pipeline.construct();
     }
     else // FaceScanSettings::RecognizeMarkedFaces
@@ -0,0 +1,471 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : maintenance tool processing thumbnails, finger-prints,
+ *               image quality and faces from a single decoding.
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "fusedprocessor.h"
+
+// Qt includes
+
+#include <QApplication>
+#include <QHash>
+#include <QIcon>
+#include <QSemaphore>
+#include <QSet>
+#include <QThread>
+
+// KDE includes
+
+#include <klocalizedstring.h>
+#include <ksharedconfig.h>
+#include <kconfiggroup.h>
+
+// Local includes
+
+#include "digikam_debug.h"
+#include "dimg.h"
+#include "coredb.h"
+#include "coredbaccess.h"
+#include "albummanager.h"
+#include "facepipeline.h"
+#include "facescansettings.h"
+#include "fusedtask.h"
+#include "imagequalitysorter.h"
+#include "iteminfo.h"
+#include "maintenancesettings.h"
+#include "maintenancethread.h"
+#include "similaritydb.h"
+#include "similaritydbaccess.h"
+#include "tagscache.h"
+#include "thumbsdb.h"
+#include "thumbsdbaccess.h"
+
+namespace Digikam
+{
+
+class Q_DECL_HIDDEN FusedProcessor::Private
+{
+public:
+
+    explicit Private()
+      : threadCompleted(false),
+        done(false),
+        facesSlots(0),
+        facesSemaphore(0),
+        pipeline(0),
+        thread(0)
+    {
+    }
+
+    bool                threadCompleted;
+    bool                done;
+
+    MaintenanceSettings settings;
+
+    QStringList         allPicturesPath;
+    QHash<QString, int> operations;
+
+    int                 facesSlots;
+    QSemaphore*         facesSemaphore;
+    FacePipeline*       pipeline;
+
+    MaintenanceThread*  thread;
+};
+
+FusedProcessor::FusedProcessor(const MaintenanceSettings& settings, ProgressItem* const parent)
+    : MaintenanceTool(QLatin1String("FusedProcessor"), parent),
+      d(new Private)
+{
+    setLabel(i18n("Thumbs, Fingerprints, Quality and Faces"));
+    ProgressManager::addProgressItem(this);
+
+    d->settings = settings;
+    d->thread   = new MaintenanceThread(this);
+
+    connect(d->thread, SIGNAL(signalCompleted()),
+            this, SLOT(slotCheckFinished()));
+
+    connect(d->thread, SIGNAL(signalAdvance(QImage)),
+            this, SLOT(slotAdvance(QImage)));
+
+    if (processesFaces(d->settings))
+    {
+        const FaceScanSettings& faceSettings = d->settings.faceSettings;
+        FacePipeline::FilterMode filterMode;
+        FacePipeline::WriteMode  writeMode;
+
+        if (faceSettings.alreadyScannedHandling == FaceScanSettings::Skip)
+        {
+            filterMode = FacePipeline::SkipAlreadyScanned;
+            writeMode  = FacePipeline::NormalWrite;
+        }
+        else if (faceSettings.alreadyScannedHandling == FaceScanSettings::Rescan)
+        {
+            filterMode = FacePipeline::ScanAll;
+            writeMode  = FacePipeline::OverwriteUnconfirmed;
+        }
+        else // FaceScanSettings::Merge
+        {
+            filterMode = FacePipeline::ScanAll;
+            writeMode  = FacePipeline::NormalWrite;
+        }
+
+        // The preview loader does nothing for the images sent with the packages.
+
+        d->pipeline = new FacePipeline;
+        d->pipeline->plugDatabaseFilter(filterMode);
+        d->pipeline->plugFacePreviewLoader();
+
+        if (faceSettings.useFullCpu)
+        {
+            d->pipeline->plugParallelFaceDetectors();
+        }
+        else
+        {
+            d->pipeline->plugFaceDetector();
+        }
+
+        if (faceSettings.task == FaceScanSettings::DetectAndRecognize)
+        {
+            d->pipeline->plugFaceRecognizer();
+            d->pipeline->activeFaceRecognizer(faceSettings.recognizeAlgorithm);
+        }
+
+        d->pipeline->plugDatabaseWriter(writeMode);
+        d->pipeline->setDetectionAccuracy(faceSettings.accuracy);
+        d->pipeline->setTwoStageDetection(faceSettings.twoStageDetection);
+        d->pipeline->construct();
+
+        // Limit the decoded images waiting in the pipeline to what the detectors can consume.
+
+        d->facesSlots     = 2 * qMax(QThread::idealThreadCount(), 1);
+        d->facesSemaphore = new QSemaphore(d->facesSlots);
+
+        connect(d->thread, SIGNAL(signalFacesImage(ItemInfo,DImg)),
+                this, SLOT(slotFacesImage(ItemInfo,DImg)));
+
+        connect(d->pipeline, SIGNAL(processed(FacePipelinePackage)),
+                this, SLOT(slotFaceProcessed(FacePipelinePackage)));
+
+        connect(d->pipeline, SIGNAL(finished()),
+                this, SLOT(slotCheckFinished()));
+    }
+}
+
+FusedProcessor::~FusedProcessor()
+{
+    // Stop the tasks before the semaphore they wait on is released.
+
+    d->thread->cancel();
+    d->thread->wait();
+
+    delete d->pipeline;
+    delete d->facesSemaphore;
+    delete d;
+}
+
+void FusedProcessor::setUseMultiCoreCPU(bool b)
+{
+    d->thread->setUseMultiCore(b);
+}
+
+bool FusedProcessor::processesFaces(const MaintenanceSettings& settings)
+{
+    return (settings.faceManagement &&
+            ((settings.faceSettings.task == FaceScanSettings::Detect) ||
+             (settings.faceSettings.task == FaceScanSettings::DetectAndRecognize)));
+}
+
+bool FusedProcessor::processesQuality(const MaintenanceSettings& settings)
+{
+    return (settings.qualitySort && settings.quality.enableSorter);
+}
+
+bool FusedProcessor::canFuse(const MaintenanceSettings& settings)
+{
+    int count = 0;
+
+    if (settings.thumbnails)
+    {
+        ++count;
+    }
+
+    if (settings.fingerPrints)
+    {
+        ++count;
+    }
+
+    if (processesQuality(settings))
+    {
+        ++count;
+    }
+
+    if (processesFaces(settings))
+    {
+        ++count;
+    }
+
+    return (count >= 2);
+}
+
+static QStringList itemPathsFromAlbums(const AlbumList& albums)
+{
+    QStringList paths;
+
+    foreach (Album* const album, albums)
+    {
+        if (!album)
+        {
+            continue;
+        }
+
+        if (album->type() == Album::PHYSICAL)
+        {
+            paths += CoreDbAccess().db()->getItemURLsInAlbum(album->id());
+        }
+        else if (album->type() == Album::TAG)
+        {
+            paths += CoreDbAccess().db()->getItemURLsInTag(album->id());
+        }
+    }
+
+    return paths;
+}
+
+void FusedProcessor::slotStart()
+{
+    MaintenanceTool::slotStart();
+
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+
+    AlbumList albumList;
+    albumList << d->settings.albums;
+    albumList << d->settings.tags;
+
+    if (albumList.isEmpty())
+    {
+        albumList = AlbumManager::instance()->allPAlbums();
+    }
+
+    QStringList paths = itemPathsFromAlbums(albumList);
+
+    // Each operation selects its items as the stand-alone tool does, the items are then merged in one list.
+
+    if (d->settings.thumbnails)
+    {
+        QHash<QString, int> withThumbnail;
+
+        if (d->settings.scanThumbs)
+        {
+            withThumbnail = ThumbsDbAccess().db()->getFilePathsWithThumbnail();
+        }
+
+        foreach (const QString& path, paths)
+        {
+            if (!withThumbnail.contains(path))
+            {
+                d->operations[path] |= FusedTask::Thumbnail;
+            }
+        }
+    }
+
+    if (d->settings.fingerPrints)
+    {
+        QSet<QString> dirty;
+
+        if (d->settings.scanFingerPrints)
+        {
+            QList<ItemInfo> imageInfos;
+            QList<qlonglong> imageIds = CoreDbAccess().db()->getImageIds(DatabaseItem::Status::Visible, DatabaseItem::Category::Image);
+
+            foreach (const qlonglong& id, imageIds)
+            {
+                imageInfos << ItemInfo(id);
+            }
+
+            dirty = SimilarityDbAccess().db()->getDirtyOrMissingFingerprintURLs(imageInfos).toSet();
+        }
+
+        foreach (const QString& path, paths)
+        {
+            if (!d->settings.scanFingerPrints || dirty.contains(path))
+            {
+                d->operations[path] |= FusedTask::Fingerprint;
+            }
+        }
+    }
+
+    if (processesQuality(d->settings))
+    {
+        QSet<QString> dirty;
+        bool nonAssigned = (d->settings.qualityScanMode == ImageQualitySorter::NonAssignedItems);
+
+        if (nonAssigned)
+        {
+            dirty = CoreDbAccess().db()->getItemsURLsWithTag(TagsCache::instance()->tagForPickLabel(NoPickLabel)).toSet();
+        }
+
+        foreach (const QString& path, paths)
+        {
+            if (!nonAssigned || dirty.contains(path))
+            {
+                d->operations[path] |= FusedTask::Quality;
+            }
+        }
+    }
+
+    if (processesFaces(d->settings))
+    {
+        AlbumList faceAlbums = d->settings.faceSettings.albums;
+
+        if (faceAlbums.isEmpty())
+        {
+            faceAlbums = AlbumManager::instance()->allPAlbums();
+        }
+
+        QStringList facePaths = itemPathsFromAlbums(faceAlbums);
+
+        foreach (const QString& path, facePaths)
+        {
+            d->operations[path] |= FusedTask::Faces;
+        }
+
+        paths += facePaths;
+    }
+
+    // Keep the album order, each item is processed once.
+
+    QSet<QString> seen;
+
+    foreach (const QString& path, paths)
+    {
+        if (d->operations.value(path) && !seen.contains(path))
+        {
+            seen.insert(path);
+            d->allPicturesPath << path;
+        }
+    }
+
+    QApplication::restoreOverrideCursor();
+
+    if (d->allPicturesPath.isEmpty())
+    {
+        slotDone();
+        return;
+    }
+
+    setTotalItems(d->allPicturesPath.count());
+
+    qCDebug(DIGIKAM_GENERAL_LOG) << "Fused pass on" << d->allPicturesPath.count() << "items";
+
+    d->thread->runFusedPass(d->allPicturesPath,
+                            d->operations,
+                            d->settings.quality,
+                            (d->settings.faceSettings.alreadyScannedHandling == FaceScanSettings::Skip),
+                            d->facesSemaphore);
+    d->thread->start();
+}
+
+void FusedProcessor::slotAdvance(const QImage& img)
+{
+    setThumbnail(QIcon(QPixmap::fromImage(img)));
+    advance(1);
+}
+
+void FusedProcessor::slotFacesImage(const ItemInfo& info, const DImg& image)
+{
+    if (canceled() || !d->pipeline->process(info, image))
+    {
+        // Skipped by the pipeline filter, the slot is free again.
+        d->facesSemaphore->release();
+        slotCheckFinished();
+    }
+}
+
+void FusedProcessor::slotFaceProcessed(const FacePipelinePackage&)
+{
+    d->facesSemaphore->release();
+    slotCheckFinished();
+}
+
+void FusedProcessor::slotCheckFinished()
+{
+    if (sender() == d->thread)
+    {
+        d->threadCompleted = true;
+    }
+
+    // All decoded images must have been processed by the face pipeline too.
+
+    if (!d->threadCompleted)
+    {
+        return;
+    }
+
+    if (d->pipeline && (!d->pipeline->hasFinished() ||
+                        (d->facesSemaphore->available() < d->facesSlots)))
+    {
+        return;
+    }
+
+    slotDone();
+}
+
+void FusedProcessor::slotDone()
+{
+    if (d->done)
+    {
+        return;
+    }
+
+    d->done = true;
+
+    // Switch on the first run flags of the stand-alone tools on digiKam config file.
+
+    KConfigGroup group = KSharedConfig::openConfig()->group(QLatin1String("General Settings"));
+
+    if (d->settings.fingerPrints)
+    {
+        group.writeEntry(QLatin1String("Finger Prints Generator First Run"), true);
+    }
+
+    if (processesFaces(d->settings))
+    {
+        group.writeEntry(QLatin1String("Face Scanner First Run"), true);
+    }
+
+    MaintenanceTool::slotDone();
+}
+
+void FusedProcessor::slotCancel()
+{
+    d->thread->cancel();
+
+    if (d->pipeline)
+    {
+        d->pipeline->shutDown();
+    }
+
+    MaintenanceTool::slotCancel();
+}
+
+} // namespace Digikam
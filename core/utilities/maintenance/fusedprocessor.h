@@ -0,0 +1,92 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : maintenance tool processing thumbnails, finger-prints,
+ *               image quality and faces from a single decoding.
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_FUSED_PROCESSOR_H
+#define DIGIKAM_FUSED_PROCESSOR_H
+
+// Qt includes
+
+#include <QObject>
+#include <QImage>
+
+// Local includes
+
+#include "maintenancetool.h"
+
+namespace Digikam
+{
+
+class DImg;
+class FacePipelinePackage;
+class ItemInfo;
+class MaintenanceSettings;
+
+/**
+ * Run the thumbnails, the finger-prints, the image quality and the face detection
+ * operations of the maintenance settings in one pass: each item is decoded once and
+ * all the operations use this decoded image. The face detection runs in the face
+ * pipeline, fed with the decoded images.
+ */
+class FusedProcessor : public MaintenanceTool
+{
+    Q_OBJECT
+
+public:
+
+    explicit FusedProcessor(const MaintenanceSettings& settings, ProgressItem* const parent = 0);
+    ~FusedProcessor();
+
+    void setUseMultiCoreCPU(bool b);
+
+    /** Return true if the settings hold at least two operations which can be run in one pass.
+     */
+    static bool canFuse(const MaintenanceSettings& settings);
+
+    /** Return true if the face operation of the settings is run by the fused pass.
+     */
+    static bool processesFaces(const MaintenanceSettings& settings);
+
+    /** Return true if the image quality operation of the settings is run by the fused pass.
+     */
+    static bool processesQuality(const MaintenanceSettings& settings);
+
+private Q_SLOTS:
+
+    void slotStart();
+    void slotDone();
+    void slotCancel();
+    void slotAdvance(const QImage&);
+    void slotFacesImage(const ItemInfo&, const DImg&);
+    void slotFaceProcessed(const FacePipelinePackage&);
+    void slotCheckFinished();
+
+private:
+
+    class Private;
+    Private* const d;
+};
+
+} // namespace Digikam
+
+#endif // DIGIKAM_FUSED_PROCESSOR_H
@@ -0,0 +1,337 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : Thread actions task processing thumbnails, finger-prints,
+ *               image quality and faces from a single decoding.
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "fusedtask.h"
+
+// Qt includes
+
+#include <QSemaphore>
+
+// Local includes
+
+#include "digikam_debug.h"
+#include "dimg.h"
+#include "faceutils.h"
+#include "haariface.h"
+#include "imagequalitycontainer.h"
+#include "imagequalityparser.h"
+#include "iteminfo.h"
+#include "maintenancedata.h"
+#include "previewloadthread.h"
+#include "thumbnailloadthread.h"
+#include "thumbnailsize.h"
+
+namespace Digikam
+{
+
+class Q_DECL_HIDDEN FusedTask::Private
+{
+public:
+
+    explicit Private()
+        : skipScannedFaces(false),
+          catcher(0),
+          imgqsort(0),
+          facesSemaphore(0),
+          data(0)
+    {
+    }
+
+    bool                   skipScannedFaces;
+
+    QHash<QString, int>    operations;
+    ImageQualityContainer  quality;
+
+    ThumbnailImageCatcher* catcher;
+    ImageQualityParser*    imgqsort;
+    QSemaphore*            facesSemaphore;
+
+    MaintenanceData*       data;
+};
+
+// -------------------------------------------------------
+
+FusedTask::FusedTask()
+    : ActionJob(),
+      d(new Private)
+{
+    ThumbnailLoadThread* const thread = new ThumbnailLoadThread;
+    thread->setPixmapRequested(false);
+    thread->setThumbnailSize(ThumbnailLoadThread::maximumThumbnailSize());
+    d->catcher                        = new ThumbnailImageCatcher(thread, this);
+}
+
+FusedTask::~FusedTask()
+{
+    slotCancel();
+    cancel();
+
+    d->catcher->setActive(false);
+    d->catcher->thread()->stopAllTasks();
+
+    delete d->catcher->thread();
+    delete d->catcher;
+    delete d;
+}
+
+void FusedTask::setOperations(const QHash<QString, int>& operations)
+{
+    d->operations = operations;
+}
+
+void FusedTask::setQuality(const ImageQualityContainer& quality)
+{
+    d->quality = quality;
+}
+
+void FusedTask::setSkipScannedFaces(bool skip)
+{
+    d->skipScannedFaces = skip;
+}
+
+void FusedTask::setFacesSemaphore(QSemaphore* const semaphore)
+{
+    d->facesSemaphore = semaphore;
+}
+
+void FusedTask::setMaintenanceData(MaintenanceData* const data)
+{
+    d->data = data;
+}
+
+void FusedTask::slotCancel()
+{
+    if (d->imgqsort)
+    {
+        d->imgqsort->cancelAnalyse();
+    }
+}
+
+void FusedTask::run()
+{
+    d->catcher->setActive(true);
+
+    // While we have data (using this as check for non-null)
+    while (d->data)
+    {
+        if (m_cancel)
+        {
+            d->catcher->setActive(false);
+            d->catcher->thread()->stopAllTasks();
+            return;
+        }
+
+        QString path = d->data->getImagePath();
+
+        if (path.isEmpty())
+        {
+            break;
+        }
+
+        int operations = d->operations.value(path, NoOperation);
+        ItemInfo info  = ItemInfo::fromLocalFile(path);
+        QImage qimg;
+
+        if ((operations & Faces) && d->skipScannedFaces && FaceUtils().hasBeenScanned(info))
+        {
+            operations &= ~Faces;
+        }
+
+        switch (info.category())
+        {
+            case DatabaseItem::Image:
+            {
+                qimg = processImage(info, path, operations);
+                break;
+            }
+
+            case DatabaseItem::Video:
+            case DatabaseItem::Audio:
+            {
+                // Only the thumbnail applies here, and it is not rendered from an image preview.
+
+                if (operations & Thumbnail)
+                {
+                    qimg = generateThumbnail(path);
+                }
+
+                break;
+            }
+
+            default:
+            {
+                break;
+            }
+        }
+
+        // Dispatch progress to Progress Manager
+        emit signalFinished(qimg);
+    }
+
+    emit signalDone();
+
+    d->catcher->setActive(false);
+}
+
+QImage FusedTask::processImage(const ItemInfo& info, const QString& path, int operations)
+{
+    if (!d->facesSemaphore)
+    {
+        operations &= ~Faces;
+    }
+
+    if (operations == NoOperation)
+    {
+        return QImage();
+    }
+
+    // Wait for the face detection to catch up, the pipeline queues all images sent to it.
+
+    if ((operations & Faces) && !acquireFacesSlot())
+    {
+        return QImage();
+    }
+
+    // Decode the item once, large enough for all the operations to run.
+    // The face detection needs the same size as the face preview loader.
+
+    DImg image;
+
+    if (operations & Faces)
+    {
+        image = PreviewLoadThread::loadFastButLargeSynchronously(path, 1600);
+    }
+    else
+    {
+        int size = 0;
+
+        if (operations & Thumbnail)
+        {
+            size = qMax(size, d->catcher->thread()->storedSize());
+        }
+
+        if (operations & Fingerprint)
+        {
+            size = qMax(size, HaarIface::preferredSize());
+        }
+
+        if (operations & Quality)
+        {
+            // 1024 pixels size image must be enough to get suitable Quality results.
+            size = qMax(size, 1024);
+        }
+
+        image = PreviewLoadThread::loadFastSynchronously(path, size);
+    }
+
+    if (image.isNull() || m_cancel)
+    {
+        qCDebug(DIGIKAM_GENERAL_LOG) << "Cannot process item" << path;
+
+        if (operations & Faces)
+        {
+            d->facesSemaphore->release();
+        }
+
+        return QImage();
+    }
+
+    // The analysis run on a reduced copy, the thumbnail and the faces use the decoded image.
+
+    DImg reduced = image;
+
+    if (qMax(image.width(), image.height()) > 1024)
+    {
+        reduced = image.smoothScale(1024, 1024, Qt::KeepAspectRatio);
+    }
+
+    if (operations & Quality)
+    {
+        PickLabel pick;
+        d->imgqsort = new ImageQualityParser(reduced, d->quality, &pick);
+        d->imgqsort->startAnalyse();
+
+        if (!m_cancel)
+        {
+            ItemInfo(info).setPickLabel(pick);
+        }
+
+        delete d->imgqsort;
+        d->imgqsort = 0;
+    }
+
+    if ((operations & Fingerprint) && !m_cancel)
+    {
+        HaarIface haarIface;
+        haarIface.indexImage(info.id(), reduced);
+    }
+
+    if ((operations & Thumbnail) && !m_cancel)
+    {
+        d->catcher->thread()->storeThumbnailFromPreview(path, image);
+    }
+
+    QImage qimg = reduced.smoothScale(22, 22, Qt::KeepAspectRatio).copyQImage();
+
+    // The image is handed over last: DImg data is shared explicitly and must not be touched here anymore.
+
+    if (operations & Faces)
+    {
+        if (m_cancel)
+        {
+            d->facesSemaphore->release();
+        }
+        else
+        {
+            emit signalFacesImage(info, image);
+        }
+    }
+
+    return qimg;
+}
+
+QImage FusedTask::generateThumbnail(const QString& path)
+{
+    d->catcher->thread()->deleteThumbnail(path);
+    d->catcher->thread()->find(ThumbnailIdentifier(path));
+    d->catcher->enqueue();
+    QList<QImage> images = d->catcher->waitForThumbnails();
+
+    return images.isEmpty() ? QImage() : images.first();
+}
+
+bool FusedTask::acquireFacesSlot()
+{
+    while (!d->facesSemaphore->tryAcquire(1, 100))
+    {
+        if (m_cancel)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace Digikam
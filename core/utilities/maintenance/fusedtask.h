@@ -0,0 +1,111 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * http://www.digikam.org
+ *
+ * Date        : 2019-06-01
+ * Description : Thread actions task processing thumbnails, finger-prints,
+ *               image quality and faces from a single decoding.
+ *
+ * Copyright (C) 2019 by Gilles Caulier <caulier dot gilles at gmail dot com>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_FUSED_TASK_H
+#define DIGIKAM_FUSED_TASK_H
+
+// Qt includes
+
+#include <QHash>
+#include <QImage>
+#include <QString>
+
+// Local includes
+
+#include "actionthreadbase.h"
+
+class QSemaphore;
+
+namespace Digikam
+{
+
+class DImg;
+class ItemInfo;
+class ImageQualityContainer;
+class MaintenanceData;
+
+class FusedTask : public ActionJob
+{
+    Q_OBJECT
+
+public:
+
+    enum Operation
+    {
+        NoOperation = 0x00,
+        Thumbnail   = 0x01,
+        Fingerprint = 0x02,
+        Quality     = 0x04,
+        Faces       = 0x08
+    };
+
+public:
+
+    explicit FusedTask();
+    ~FusedTask();
+
+    /** The operations to run on each item, as a combination of Operation values by item path.
+     */
+    void setOperations(const QHash<QString, int>& operations);
+    void setQuality(const ImageQualityContainer& quality);
+
+    /** Do not send the items already scanned for faces to the face detection.
+     */
+    void setSkipScannedFaces(bool skip);
+
+    /** Each item sent with signalFacesImage() takes one resource of the semaphore,
+     *  which must be released by the receiver when the face detection is done.
+     *  This limits the amount of decoded images waiting for face detection.
+     */
+    void setFacesSemaphore(QSemaphore* const semaphore);
+    void setMaintenanceData(MaintenanceData* const data=0);
+
+Q_SIGNALS:
+
+    void signalFinished(const QImage&);
+    void signalFacesImage(const ItemInfo&, const DImg&);
+
+public Q_SLOTS:
+
+    void slotCancel();
+
+protected:
+
+    void run();
+
+private:
+
+    QImage processImage(const ItemInfo& info, const QString& path, int operations);
+    QImage generateThumbnail(const QString& path);
+    bool   acquireFacesSlot();
+
+private:
+
+    class Private;
+    Private* const d;
+};
+
+} // namespace Digikam
+
+#endif // DIGIKAM_FUSED_TASK_H
@@ -85,6 +85,7 @@ public:
         scanThumbs(0),
         scanFingerPrints(0),
         useMutiCoreCPU(0),
+        fusedPass(0),
         cleanThumbsDb(0),
         cleanFacesDb(0),
         shrinkDatabases(0),
@@ -109,6 +110,7 @@ public:
 
     static const QString configGroupName;
     static const QString configUseMutiCoreCPU;
+    static const QString configFusedPass;
     static const QString configNewItems;
     static const QString configThumbnails;
     static const QString configScanThumbs;
@@ -135,6 +137,7 @@ public:
     QCheckBox*           scanThumbs;
     QCheckBox*           scanFingerPrints;
     QCheckBox*           useMutiCoreCPU;
+    QCheckBox*           fusedPass;
     QCheckBox*           cleanThumbsDb;
     QCheckBox*           cleanFacesDb;
     QCheckBox*           shrinkDatabases;
@@ -158,6 +161,7 @@ public:
 
 const QString MaintenanceDlg::Private::configGroupName(QLatin1String("MaintenanceDlg Settings"));
 const QString MaintenanceDlg::Private::configUseMutiCoreCPU(QLatin1String("UseMutiCoreCPU"));
+const QString MaintenanceDlg::Private::configFusedPass(QLatin1String("FusedPass"));
 const QString MaintenanceDlg::Private::configNewItems(QLatin1String("NewItems"));
 const QString MaintenanceDlg::Private::configThumbnails(QLatin1String("Thumbnails"));
 const QString MaintenanceDlg::Private::configScanThumbs(QLatin1String("ScanThumbs"));
@@ -210,6 +214,10 @@ MaintenanceDlg::MaintenanceDlg(QWidget* const parent)
     DVBox* const options       = new DVBox;
     d->albumSelectors          = new AlbumSelectors(i18nc("@label", "Process items from:"), d->configGroupName, options);
     d->useMutiCoreCPU          = new QCheckBox(i18nc("@option:check", "Work on all processor cores (when it possible)"), options);
+    d->fusedPass               = new QCheckBox(i18nc("@option:check", "Load each item only once for thumbnails, fingerprints, image quality and faces"), options);
+    d->fusedPass->setWhatsThis(i18n("If this option is enabled, the thumbnails, the fingerprints, the image quality "
+                                    "and the face detection are computed together from a single loading of each item. "
+                                    "This is faster when several of these operations are selected."));
     d->expanderBox->insertItem(Private::Options, options, QIcon::fromTheme(QLatin1String("configure")), i18n("Common Options"), QLatin1String("Options"), true);
 
     // --------------------------------------------------------------------------------------
@@ -413,6 +421,7 @@ MaintenanceSettings MaintenanceDlg::settings() const
     prm.albums                              = d->albumSelectors->selectedAlbums();
     prm.tags                                = d->albumSelectors->selectedTags();
     prm.useMutiCoreCPU                      = d->useMutiCoreCPU->isChecked();
+    prm.fusedPass                           = d->fusedPass->isChecked();
     prm.newItems                            = d->expanderBox->isChecked(Private::NewItems);
     prm.databaseCleanup                     = d->expanderBox->isChecked(Private::DbCleanup);
     prm.cleanThumbDb                        = d->cleanThumbsDb->isChecked();
@@ -451,6 +460,7 @@ void MaintenanceDlg::readSettings()
     MaintenanceSettings prm;
 
     d->useMutiCoreCPU->setChecked(group.readEntry(d->configUseMutiCoreCPU,                                  prm.useMutiCoreCPU));
+    d->fusedPass->setChecked(group.readEntry(d->configFusedPass,                                            prm.fusedPass));
     d->expanderBox->setChecked(Private::NewItems,           group.readEntry(d->configNewItems,              prm.newItems));
 
     d->expanderBox->setChecked(Private::DbCleanup,          group.readEntry(d->configCleanupDatabase,       prm.databaseCleanup));
@@ -500,6 +510,7 @@ void MaintenanceDlg::writeSettings()
     MaintenanceSettings prm   = settings();
 
     group.writeEntry(d->configUseMutiCoreCPU,        prm.useMutiCoreCPU);
+    group.writeEntry(d->configFusedPass,             prm.fusedPass);
     group.writeEntry(d->configNewItems,              prm.newItems);
     group.writeEntry(d->configCleanupDatabase,       prm.databaseCleanup);
     group.writeEntry(d->configCleanupThumbDatabase,  prm.cleanThumbDb);
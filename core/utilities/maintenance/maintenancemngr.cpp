@@ -49,6 +49,7 @@
 #include "progressmanager.h"
 #include "facesdetector.h"
 #include "dbcleaner.h"
+#include "fusedprocessor.h"
 
 namespace Digikam
 {
@@ -68,6 +69,15 @@ public:
         imageQualitySorter    = 0;
         facesDetector         = 0;
         databaseCleaner       = 0;
+        fusedProcessor        = 0;
+    }
+
+    /** Return true if the thumbnails, finger-prints, image quality and faces operations
+     *  are run together by the fused processor.
+     */
+    bool fusedPass() const
+    {
+        return (settings.fusedPass && FusedProcessor::canFuse(settings));
     }
 
     bool                   running;
@@ -84,6 +94,7 @@ public:
     ImageQualitySorter*    imageQualitySorter;
     FacesDetector*         facesDetector;
     DbCleaner*             databaseCleaner;
+    FusedProcessor*        fusedProcessor;
 };
 
 MaintenanceMngr::MaintenanceMngr(QObject* const parent)
@@ -137,6 +148,11 @@ void MaintenanceMngr::slotToolCompleted(ProgressItem* tool)
         d->thumbsGenerator = 0;
         stage4();
     }
+    else if (tool == dynamic_cast<ProgressItem*>(d->fusedProcessor))
+    {
+        d->fusedProcessor = 0;
+        stage4();
+    }
     else if (tool == dynamic_cast<ProgressItem*>(d->fingerPrintsGenerator))
     {
         d->fingerPrintsGenerator = 0;
@@ -168,6 +184,7 @@ void MaintenanceMngr::slotToolCanceled(ProgressItem* tool)
 {
     if (tool == dynamic_cast<ProgressItem*>(d->newItemsFinder)        ||
         tool == dynamic_cast<ProgressItem*>(d->thumbsGenerator)       ||
+        tool == dynamic_cast<ProgressItem*>(d->fusedProcessor)        ||
         tool == dynamic_cast<ProgressItem*>(d->fingerPrintsGenerator) ||
         tool == dynamic_cast<ProgressItem*>(d->duplicatesFinder)      ||
         tool == dynamic_cast<ProgressItem*>(d->databaseCleaner)       ||
@@ -236,7 +253,16 @@ void MaintenanceMngr::stage3()
 {
     qCDebug(DIGIKAM_GENERAL_LOG) << "stage3";
 
-    if (d->settings.thumbnails)
+    if (d->fusedPass())
+    {
+        // NOTE : Use multi-core CPU option is passed through FaceScanSettings
+        d->settings.faceSettings.useFullCpu = d->settings.useMutiCoreCPU;
+        d->fusedProcessor                   = new FusedProcessor(d->settings);
+        d->fusedProcessor->setNotificationEnabled(false);
+        d->fusedProcessor->setUseMultiCoreCPU(d->settings.useMutiCoreCPU);
+        d->fusedProcessor->start();
+    }
+    else if (d->settings.thumbnails)
     {
         bool rebuildAll = (d->settings.scanThumbs == false);
         AlbumList list;
@@ -258,7 +284,7 @@ void MaintenanceMngr::stage4()
 {
     qCDebug(DIGIKAM_GENERAL_LOG) << "stage4";
 
-    if (d->settings.fingerPrints)
+    if (d->settings.fingerPrints && !d->fusedPass())
     {
         bool rebuildAll = (d->settings.scanFingerPrints == false);
         AlbumList list;
@@ -297,7 +323,8 @@ void MaintenanceMngr::stage6()
 {
     qCDebug(DIGIKAM_GENERAL_LOG) << "stage6";
 
-    if (d->settings.faceManagement)
+    if (d->settings.faceManagement &&
+        !(d->fusedPass() && FusedProcessor::processesFaces(d->settings)))
     {
         // NOTE : Use multi-core CPU option is passed through FaceScanSettings
         d->settings.faceSettings.useFullCpu = d->settings.useMutiCoreCPU;
@@ -315,7 +342,7 @@ void MaintenanceMngr::stage7()
 {
     qCDebug(DIGIKAM_GENERAL_LOG) << "stage7";
 
-    if (d->settings.qualitySort && d->settings.quality.enableSorter)
+    if (FusedProcessor::processesQuality(d->settings) && !d->fusedPass())
     {
         AlbumList list;
         list << d->settings.albums;
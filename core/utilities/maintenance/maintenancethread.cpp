@@ -36,6 +36,7 @@
 #include "thumbstask.h"
 #include "fingerprintstask.h"
 #include "imagequalitytask.h"
+#include "fusedtask.h"
 #include "imagequalitycontainer.h"
 #include "databasetask.h"
 #include "maintenancedata.h"
@@ -169,6 +170,42 @@ void MaintenanceThread::sortByImageQuality(const QStringList& paths, const Image
     appendJobs(collection);
 }
 
+void MaintenanceThread::runFusedPass(const QStringList& paths,
+                                     const QHash<QString, int>& operations,
+                                     const ImageQualityContainer& quality,
+                                     bool skipScannedFaces,
+                                     QSemaphore* const facesSemaphore)
+{
+    ActionJobCollection collection;
+
+    data->setImagePaths(paths);
+
+    for (int i = 1 ; i <= maximumNumberOfThreads() ; ++i)
+    {
+        FusedTask* const t = new FusedTask();
+        t->setOperations(operations);
+        t->setQuality(quality);
+        t->setSkipScannedFaces(skipScannedFaces);
+        t->setFacesSemaphore(facesSemaphore);
+        t->setMaintenanceData(data);
+
+        connect(t, SIGNAL(signalFinished(QImage)),
+                this, SIGNAL(signalAdvance(QImage)));
+
+        connect(t, SIGNAL(signalFacesImage(ItemInfo,DImg)),
+                this, SIGNAL(signalFacesImage(ItemInfo,DImg)));
+
+        connect(this, SIGNAL(signalCanceled()),
+                t, SLOT(slotCancel()), Qt::QueuedConnection);
+
+        collection.insert(t, 0);
+
+        qCDebug(DIGIKAM_GENERAL_LOG) << "Creating a fused task for processing items with one decoding.";
+    }
+
+    appendJobs(collection);
+}
+
 void MaintenanceThread::computeDatabaseJunk(bool thumbsDb, bool facesDb, bool similarityDb)
 {
     ActionJobCollection collection;
@@ -25,6 +25,10 @@
 #ifndef DIGIKAM_MAINTENANCE_THREAD_H
 #define DIGIKAM_MAINTENANCE_THREAD_H
 
+// Qt includes
+
+#include <QHash>
+
 // Local includes
 
 #include "actionthreadbase.h"
@@ -33,10 +37,12 @@
 #include "identity.h"
 
 class QImage;
+class QSemaphore;
 
 namespace Digikam
 {
 
+class DImg;
 class ImageQualityContainer;
 class MaintenanceData;
 
@@ -56,6 +62,15 @@ public:
     void generateFingerprints(const QStringList& paths);
     void sortByImageQuality(const QStringList& paths, const ImageQualityContainer& quality);
 
+    /** Run the operations of FusedTask on the items, with one decoding by item.
+     *  The images for face detection are sent with signalFacesImage(), see FusedTask::setFacesSemaphore().
+     */
+    void runFusedPass(const QStringList& paths,
+                      const QHash<QString, int>& operations,
+                      const ImageQualityContainer& quality,
+                      bool skipScannedFaces,
+                      QSemaphore* const facesSemaphore);
+
     void computeDatabaseJunk(bool thumbsDb=false, bool facesDb=false, bool similarityDb=false);
     void cleanCoreDb(const QList<qlonglong>& imageIds);
     void cleanThumbsDb(const QList<int>& thumbnailIds);
@@ -77,6 +92,10 @@ Q_SIGNALS:
      */
     void signalAdvance(const QImage&);
 
+    /** Emit when an item was decoded for the face detection by the fused pass.
+     */
+    void signalFacesImage(const ItemInfo&, const DImg&);
+
     /** Emit when an itam was processed and on additional information is necessary.
      */
     void signalAdvance();
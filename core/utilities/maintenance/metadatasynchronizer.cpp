@@ -29,6 +29,7 @@
 #include <QString>
 #include <QTimer>
 #include <QIcon>
+#include <QElapsedTimer>
 
 // KDE includes
 
@@ -36,6 +37,7 @@
 
 // Local includes
 
+#include "digikam_debug.h"
 #include "albummanager.h"
 #include "iteminfojob.h"
 #include "maintenancethread.h"
@@ -66,6 +68,8 @@ public:
 
     MetadataSynchronizer::SyncDirection direction;
     bool                                tagsOnly;
+
+    QElapsedTimer                       clock;
 };
 
 MetadataSynchronizer::MetadataSynchronizer(const AlbumList& list, SyncDirection direction, ProgressItem* const parent)
@@ -205,6 +209,7 @@ void MetadataSynchronizer::parseList()
     }
 
     setTotalItems(d->imageInfoList.count());
+    d->clock.start();
 
     d->thread->syncMetadata(d->imageInfoList, d->direction, d->tagsOnly);
     d->thread->start();
@@ -215,4 +220,30 @@ void MetadataSynchronizer::slotAdvance()
     advance(1);
 }
 
+void MetadataSynchronizer::slotDone()
+{
+    if (d->clock.isValid())
+    {
+        qCDebug(DIGIKAM_GENERAL_LOG) << "Metadata synchronized for" << completedItems() << "items in"
+                                     << d->clock.elapsed() << "ms (" << throughput() << "items/s)";
+    }
+
+    MaintenanceTool::slotDone();
+}
+
+int MetadataSynchronizer::queueDepth() const
+{
+    return (totalItems() - completedItems());
+}
+
+double MetadataSynchronizer::throughput() const
+{
+    if (!d->clock.isValid() || (d->clock.elapsed() == 0))
+    {
+        return 0.0;
+    }
+
+    return (completedItems() * 1000.0 / d->clock.elapsed());
+}
+
 } // namespace Digikam
@@ -67,9 +67,18 @@ public:
 
     void setUseMultiCoreCPU(bool b);
 
+    /** Return the number of items still waiting to be synchronized.
+     */
+    int queueDepth() const;
+
+    /** Return the number of items synchronized per second since the synchronization started.
+     */
+    double throughput() const;
+
 private Q_SLOTS:
 
     void slotStart();
+    void slotDone();
     void slotParseAlbums();
     void slotAlbumParsed(const ItemInfoList&);
     void slotAdvance();
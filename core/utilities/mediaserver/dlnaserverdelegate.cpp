@@ -45,6 +45,16 @@
 #include <QImage>
 #include <QByteArray>
 #include <QBuffer>
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSet>
+#include <QStandardPaths>
+#include <QWaitCondition>
 
 // Local includes
 
@@ -64,10 +74,39 @@ public:
 
     explicit Private()
       : filterUnknownOut(false),
-        useCache(false)
+        useCache(false),
+        variantCacheMaxSize(512 * 1024 * 1024)
     {
+        variantCacheDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) +
+                          QLatin1String("/mediaserver");
+
+        // Resized image variants advertised with each image item, as name and bounding box.
+
+        variants.insert(1080, QSize(1920, 1080));
+        variants.insert(2160, QSize(3840, 2160));
     }
 
+    /**
+     * Return the path of a JPEG copy of the image scaled to fit in the size of the variant,
+     * from the disk cache. The copy is generated if it does not exist yet or if the original
+     * file changed. Return an empty string if the image cannot be loaded.
+     */
+    QString variantFile(const QString& filePath, int variant);
+
+    /**
+     * Load and scale the image, and write the variant to the cache path.
+     * Called without lock, only one request generates a given cache path at a time.
+     */
+    bool    createVariant(const QString& filePath, int variant, const QString& cachePath);
+
+    /**
+     * Remove the oldest cached variants until the cache fits in variantCacheMaxSize.
+     * The variants written in the last minute are kept.
+     */
+    void    trimVariantCache();
+
+public:
+
     NPT_String                                                          urlRoot;
     NPT_String                                                          fileRoot;
     bool                                                                filterUnknownOut;
@@ -76,8 +115,144 @@ public:
     MediaServerMap                                                      map;
 
     PLT_MediaCache<NPT_Reference<NPT_List<NPT_String> >, NPT_TimeStamp> dirCache;
+
+    QMap<int, QSize>                                                    variants;
+    QString                                                             variantCacheDir;
+    qint64                                                              variantCacheMaxSize;
+    QMutex                                                              variantMutex;
+    QWaitCondition                                                      variantDone;
+    QSet<QString>                                                       variantsInProgress;
 };
 
+QString DLNAMediaServerDelegate::Private::variantFile(const QString& filePath, int variant)
+{
+    QFileInfo info(filePath);
+
+    if (!info.exists() || !variants.contains(variant))
+    {
+        return QString();
+    }
+
+    // The key changes with the original file, an outdated variant is never served and goes away with the trimming.
+
+    QByteArray key = filePath.toUtf8()                                          + '|' +
+                     QByteArray::number(variant)                                + '|' +
+                     QByteArray::number(info.lastModified().toMSecsSinceEpoch()) + '|' +
+                     QByteArray::number(info.size());
+
+    QString cachePath = variantCacheDir + QLatin1Char('/') +
+                        QString::fromLatin1(QCryptographicHash::hash(key, QCryptographicHash::Md5).toHex()) +
+                        QLatin1String(".jpg");
+
+    // The lock is only held to check the cache: variants of different images are generated in parallel,
+    // and a request for a variant under generation waits for it.
+
+    {
+        QMutexLocker lock(&variantMutex);
+
+        while (variantsInProgress.contains(cachePath))
+        {
+            variantDone.wait(&variantMutex);
+        }
+
+        if (QFileInfo::exists(cachePath))
+        {
+            return cachePath;
+        }
+
+        variantsInProgress.insert(cachePath);
+    }
+
+    bool created = createVariant(filePath, variant, cachePath);
+
+    QMutexLocker lock(&variantMutex);
+
+    if (created)
+    {
+        trimVariantCache();
+    }
+
+    variantsInProgress.remove(cachePath);
+    variantDone.wakeAll();
+
+    return (created ? cachePath : QString());
+}
+
+bool DLNAMediaServerDelegate::Private::createVariant(const QString& filePath, int variant, const QString& cachePath)
+{
+    if (!QDir().mkpath(variantCacheDir))
+    {
+        qCWarning(DIGIKAM_MEDIASRV_LOG) << "Cannot create the media server cache directory" << variantCacheDir;
+        return false;
+    }
+
+    DImg dimg = PreviewLoadThread::loadHighQualitySynchronously(filePath);
+
+    if (dimg.isNull())
+    {
+        return false;
+    }
+
+    // Never upscale the image, the variant is only useful to reduce the transfer.
+
+    QSize box = variants.value(variant);
+
+    if (dimg.width() > box.width() || dimg.height() > box.height())
+    {
+        dimg = dimg.smoothScale(box, Qt::KeepAspectRatio);
+    }
+
+    // Write under a temporary name first, a concurrent request must not serve a partial file.
+
+    QString tmpPath = cachePath + QLatin1String(".tmp");
+
+    // The pixels are already rotated: reset the orientation, update the dimensions and drop the
+    // embedded previews of the original, else the renderers honoring Exif rotate the variant again.
+
+    dimg.prepareMetadataToSave(tmpPath, QLatin1String("JPG"), QString(),
+                               DImg::RemoveOldMetadataPreviews | DImg::ResetExifOrientationTag);
+
+    if (!dimg.save(tmpPath, QLatin1String("JPG")) || !QFile::rename(tmpPath, cachePath))
+    {
+        QFile::remove(tmpPath);
+        return false;
+    }
+
+    return true;
+}
+
+void DLNAMediaServerDelegate::Private::trimVariantCache()
+{
+    QFileInfoList files = QDir(variantCacheDir).entryInfoList(QStringList() << QLatin1String("*.jpg"),
+                                                                QDir::Files, QDir::Time | QDir::Reversed);
+    qint64 total        = 0;
+
+    foreach (const QFileInfo& file, files)
+    {
+        total += file.size();
+    }
+
+    // A variant written a short time ago can have just been returned to a request which did not serve it yet.
+
+    QDateTime recent = QDateTime::currentDateTime().addSecs(-60);
+
+    foreach (const QFileInfo& file, files)
+    {
+        if (total <= variantCacheMaxSize)
+        {
+            break;
+        }
+
+        if (file.lastModified() > recent)
+        {
+            continue;
+        }
+
+        total -= file.size();
+        QFile::remove(file.absoluteFilePath());
+    }
+}
+
 DLNAMediaServerDelegate::DLNAMediaServerDelegate(const char* url_root,
                                                  bool        use_cache)
     : d(new Private)
@@ -115,6 +290,20 @@ NPT_Result DLNAMediaServerDelegate::ProcessFileRequest(NPT_HttpRequest&
     NPT_String file_path;
     NPT_CHECK_LABEL_WARNING(ExtractResourcePath(request.GetUrl(), file_path), failure);
 
+    // Serve a resized variant of the image if requested
+
+    {
+        const char* const variant = query.GetField("variant");
+
+        if (variant)
+        {
+            NPT_CHECK_WARNING(ServeVariant(request, context, response,
+                                           NPT_FilePath::Create(d->fileRoot, file_path),
+                                           NPT_String(variant)));
+            return NPT_SUCCESS;
+        }
+    }
+
     // Serve file
 
     NPT_CHECK_WARNING(ServeFile(request, context, response, NPT_FilePath::Create(d->fileRoot, file_path)));
@@ -280,13 +469,25 @@ NPT_Result DLNAMediaServerDelegate::OnBrowseDirectChildren(PLT_ActionReference&
 
     PLT_MediaObjectReference item;
 
+    // The entries come from the albums registered on the server, without file system access.
+    // All entries are filtered to count the matches, but only the items from the requested page
+    // are built, as this stats the files.
+
     for (NPT_List<NPT_String>::Iterator it = entries->GetFirstItem() ; it ; ++it)
     {
         NPT_String filepath = dir + (*it);
 
         // verify we want to process this file first
 
-        if (!ProcessFile(filepath, filter))
+        if (!IsListed(filepath, filter, context))
+        {
+            continue;
+        }
+
+        ++total_matches;
+
+        if ((cur_index++ < starting_index) ||
+            ((requested_count != 0) && (num_returned >= requested_count)))
         {
             continue;
         }
@@ -302,24 +503,21 @@ NPT_Result DLNAMediaServerDelegate::OnBrowseDirectChildren(PLT_ActionReference&
                                  true,
                                  allip);
 
-        // generate didl if within range requested
+        // generate didl for the item in the range requested
 
-        if (!item.IsNull())
+        if (item.IsNull())
         {
-            if ((cur_index >= starting_index) &&
-                ((num_returned < requested_count) || (requested_count == 0)))
-            {
-                NPT_String tmp;
-                NPT_CHECK_SEVERE(PLT_Didl::ToDidl(*item.AsPointer(), filter, tmp));
+            // The file cannot be accessed anymore.
+            --total_matches;
+            continue;
+        }
 
-                didl += tmp;
-                ++num_returned;
-            }
+        NPT_String tmp;
+        NPT_CHECK_SEVERE(PLT_Didl::ToDidl(*item.AsPointer(), filter, tmp));
 
-            ++cur_index;
-            ++total_matches;
-        }
-    };
+        didl += tmp;
+        ++num_returned;
+    }
 
     didl += didl_footer;
 
@@ -449,6 +647,27 @@ PLT_MediaObject* DLNAMediaServerDelegate::BuildFromFilePath(const NPT_String&
         {
             resource.m_Uri = BuildResourceUri(base_uri, ip->ToString(), url);
             object->m_Resources.Add(resource);
+
+            // add the resized variants of the images, for renderers which do not need the full resolution
+
+            if (object->m_ObjectClass.type.StartsWith("object.item.imageItem"))
+            {
+                QMap<int, QSize>::const_iterator variant = d->variants.constBegin();
+
+                for ( ; variant != d->variants.constEnd() ; ++variant)
+                {
+                    PLT_MediaItemResource variantResource;
+                    NPT_HttpUrl           variantUrl(resource.m_Uri);
+                    variantUrl.SetQuery(NPT_String("variant=") + NPT_String::FromInteger(variant.key()));
+
+                    variantResource.m_Uri          = variantUrl.ToStringWithDefaultPort(0);
+                    variantResource.m_ProtocolInfo = PLT_ProtocolInfo::GetProtocolInfoFromMimeType("image/jpeg", true, &context);
+                    variantResource.m_Resolution   = NPT_String::FromInteger(variant.value().width())  + "x" +
+                                                     NPT_String::FromInteger(variant.value().height());
+                    object->m_Resources.Add(variantResource);
+                }
+            }
+
             ++ip;
 
             // if we only want the one resource reachable by client
@@ -486,11 +705,23 @@ PLT_MediaObject* DLNAMediaServerDelegate::BuildFromFilePath(const NPT_String&
 
         // Get the number of children for this container
 
-        NPT_LargeSize count = 0;
-
-        if (with_count && NPT_SUCCEEDED(NPT_File::GetSize(filepath, count)))
+        if (with_count)
         {
-            ((PLT_MediaContainer*)object)->m_ChildrenCount = (NPT_Int32)count;
+            // Containers are virtual: root lists the albums and an album lists its items.
+
+            NPT_Int32 count = 0;
+
+            if (filepath.Compare("/", true) == 0)
+            {
+                count = d->map.count();
+            }
+            else
+            {
+                QString container = QString::fromUtf8(filepath.GetChars());
+                count             = d->map.value(container.remove(QLatin1Char('/'))).count();
+            }
+
+            ((PLT_MediaContainer*)object)->m_ChildrenCount = count;
         }
 
         object->m_ObjectClass.type = "object.container.storageFolder";
@@ -819,6 +1050,37 @@ NPT_Result DLNAMediaServerDelegate::ServeFile(const NPT_HttpRequest&        requ
     return NPT_SUCCESS;
 }
 
+NPT_Result DLNAMediaServerDelegate::ServeVariant(const NPT_HttpRequest&        request,
+                                                 const NPT_HttpRequestContext& context,
+                                                 NPT_HttpResponse&             response,
+                                                 const NPT_String&             file_path,
+                                                 const NPT_String&             variant)
+{
+    // prevent hackers from accessing files outside of our root
+
+    if ((file_path.Find("/..") >= 0) || (file_path.Find("\\..") >= 0))
+    {
+        return NPT_ERROR_NO_SUCH_ITEM;
+    }
+
+    int     size      = QString::fromUtf8(variant.GetChars()).toInt();
+    QString cachePath = d->variantFile(QString::fromUtf8(file_path.GetChars()), size);
+
+    if (cachePath.isEmpty())
+    {
+        qCDebug(DIGIKAM_MEDIASRV_LOG) << file_path.GetChars() << "cannot be served as variant" << size;
+
+        return NPT_ERROR_NO_SUCH_ITEM;
+    }
+
+    // The cached file is a plain JPEG file, range and conditional requests are handled as for originals.
+
+    NPT_CHECK_WARNING(PLT_HttpServer::ServeFile(request, context, response,
+                                                NPT_String(cachePath.toUtf8().constData())));
+
+    return NPT_SUCCESS;
+}
+
 NPT_String DLNAMediaServerDelegate::BuildResourceUri(const NPT_HttpUrl& base_uri,
                                                      const char*        host,
                                                      const char*        file_path)
@@ -840,4 +1102,32 @@ bool DLNAMediaServerDelegate::ProcessFile(const NPT_String&, const char*)
     return true;
 }
 
+bool DLNAMediaServerDelegate::IsListed(const NPT_String&             filepath,
+                                       const char*                   filter,
+                                       const PLT_HttpRequestContext& context)
+{
+    if (!ProcessFile(filepath, filter))
+    {
+        return false;
+    }
+
+    // Containers are always listed.
+
+    if (filepath.EndsWith("/"))
+    {
+        return true;
+    }
+
+    // Same checks as BuildFromFilePath(), from the file name only.
+
+    if (d->filterUnknownOut &&
+        NPT_StringsEqual(PLT_MimeType::GetMimeType(filepath, &context),
+                         "application/octet-stream"))
+    {
+        return false;
+    }
+
+    return PLT_ProtocolInfo::GetProtocolInfo(filepath, true, &context).IsValid();
+}
+
 } // namespace Digikam
@@ -108,6 +108,15 @@ protected:
                                  NPT_HttpResponse&             response,
                                  const NPT_String&             file_path);
 
+    /**
+     * Serve a JPEG copy of the image scaled down to the variant size, from the disk cache.
+     */
+    virtual NPT_Result ServeVariant(const NPT_HttpRequest&        request,
+                                    const NPT_HttpRequestContext& context,
+                                    NPT_HttpResponse&             response,
+                                    const NPT_String&             file_path,
+                                    const NPT_String&             variant);
+
     virtual NPT_Result GetFilePath(const char* object_id,
                                    NPT_String& filepath);
 
@@ -120,6 +129,16 @@ protected:
                                                bool                          keep_extension_in_title = false,
                                                bool                          allip = false);
 
+private:
+
+    /**
+     * Return true if the entry is shown in the browse results. This runs the checks
+     * of BuildFromFilePath() which only need the file name, without to access the file.
+     */
+    bool IsListed(const NPT_String&             filepath,
+                  const char*                   filter,
+                  const PLT_HttpRequestContext& context);
+
 protected:
 
     friend class PLT_MediaItem;
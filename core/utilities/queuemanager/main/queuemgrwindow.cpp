@@ -1014,6 +1014,11 @@ void QueueMgrWindow::slotQueueProcessed()
     d->currentQueueToProcess++;
     QString msg;
 
+    foreach (const QString& line, d->thread->timingReport())
+    {
+        d->toolsView->addHistoryEntry(line, DHistoryView::ProgressEntry);
+    }
+
     if (!d->processingAllQueues) {
         msg = i18n("Batch queue finished");
     }
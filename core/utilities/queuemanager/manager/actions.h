@@ -29,6 +29,7 @@
 #include <QString>
 #include <QMetaType>
 #include <QUrl>
+#include <QMap>
 
 namespace Digikam
 {
@@ -63,6 +64,9 @@ public:
 
     QUrl         fileUrl;
     QUrl         destUrl;
+
+    /// Time spent in milliseconds by each tool (by title) to process the item.
+    QMap<QString, qint64> toolTimes;
 };
 
 } // namespace Digikam
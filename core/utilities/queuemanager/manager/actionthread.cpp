@@ -24,11 +24,21 @@
 
 #include "actionthread.h"
 
+// Qt includes
+
+#include <QElapsedTimer>
+
+// KDE includes
+
+#include <klocalizedstring.h>
+
 // Local includes
 
 #include "digikam_debug.h"
 #include "digikam_config.h"
 #include "collectionscanner.h"
+#include "batchtoolsfactory.h"
+#include "parallelworkers.h"
 #include "task.h"
 
 namespace Digikam
@@ -40,9 +50,36 @@ public:
 
     explicit Private()
     {
+        processedItems = 0;
+    }
+
+    /**
+     * Return true if one tool from the chain runs its own sub-threads to process an image.
+     */
+    bool hasMultithreadedTool(const AssignedBatchTools& item) const
+    {
+        foreach (const BatchToolSet& set, item.m_toolsList)
+        {
+            BatchTool* const tool = BatchToolsFactory::instance()->findTool(set.name, set.group);
+
+            if (tool && tool->isMultithreaded())
+            {
+                return true;
+            }
+        }
+
+        return false;
     }
 
-    QueueSettings settings;
+public:
+
+    QueueSettings         settings;
+
+    /// Statistics about the queue under processing, for the timing report.
+    QElapsedTimer         queueTimer;
+    int                   processedItems;
+    QMap<QString, qint64> toolTimes;
+    QStringList           timingReport;
 };
 
 // --------------------------------------------------------------------------------------
@@ -54,6 +91,9 @@ ActionThread::ActionThread(QObject* const parent)
     setObjectName(QLatin1String("QueueMngrThread"));
     qRegisterMetaType<ActionData>();
 
+    // Items share the threads with the multithreaded filters: see setUseGlobalThreadPool().
+    setUseGlobalThreadPool(true);
+
     connect(this, SIGNAL(finished()),
             this, SLOT(slotThreadFinished()));
 }
@@ -85,6 +125,30 @@ void ActionThread::processQueueItems(const QList<AssignedBatchTools>& items)
 {
     ActionJobCollection collection;
 
+    if (isEmpty())
+    {
+        d->queueTimer.start();
+        d->processedItems = 0;
+        d->toolTimes.clear();
+        d->timingReport.clear();
+    }
+
+    if (d->settings.useMultiCoreCPU && !items.isEmpty())
+    {
+        // Tools running sub-threads split each image over the shared pool. Process less items
+        // at the same time to let them use the free threads, and reduce memory use.
+        // Serial tools get one item per core.
+
+        int workers = ParallelWorkers::optimalWorkerCount();
+
+        if (d->hasMultithreadedTool(items.first()))
+        {
+            workers = qMax(1, workers / 2);
+        }
+
+        setMaximumNumberOfThreads(workers);
+    }
+
     for (int i = 0 ; i < items.size() ; ++i)
     {
         Task* const t = new Task();
@@ -116,8 +180,23 @@ void ActionThread::cancel()
     ActionThreadBase::cancel();
 }
 
+QStringList ActionThread::timingReport() const
+{
+    return d->timingReport;
+}
+
 void ActionThread::slotUpdateItemInfo(const Digikam::ActionData& ad)
 {
+    if (ad.status == ActionData::BatchDone || ad.status == ActionData::BatchFailed)
+    {
+        d->processedItems++;
+
+        for (QMap<QString, qint64>::const_iterator it = ad.toolTimes.constBegin() ; it != ad.toolTimes.constEnd() ; ++it)
+        {
+            d->toolTimes[it.key()] += it.value();
+        }
+    }
+
     if (ad.status == ActionData::BatchDone)
     {
         CollectionScanner scanner;
@@ -138,8 +217,44 @@ void ActionThread::slotThreadFinished()
     if (isEmpty())
     {
         qCDebug(DIGIKAM_GENERAL_LOG) << "List of Pending Jobs is empty";
+
+        buildTimingReport();
+
+        foreach (const QString& line, d->timingReport)
+        {
+            qCDebug(DIGIKAM_GENERAL_LOG) << line;
+        }
+
         emit signalQueueProcessed();
     }
 }
 
+void ActionThread::buildTimingReport()
+{
+    d->timingReport.clear();
+
+    if (!d->queueTimer.isValid() || d->processedItems == 0)
+    {
+        return;
+    }
+
+    const qint64 elapsed = qMax(d->queueTimer.elapsed(), (qint64)1);
+    const double perMin  = d->processedItems * 60000.0 / elapsed;
+
+    d->timingReport << i18n("%1 items processed in %2 s (%3 items per minute)",
+                            d->processedItems,
+                            QString::number(elapsed / 1000.0, 'f', 1),
+                            QString::number(perMin, 'f', 1));
+
+    for (QMap<QString, qint64>::const_iterator it = d->toolTimes.constBegin() ; it != d->toolTimes.constEnd() ; ++it)
+    {
+        d->timingReport << i18n("Tool \"%1\": %2 s in total, %3 ms per item",
+                                it.key(),
+                                QString::number(it.value() / 1000.0, 'f', 1),
+                                it.value() / d->processedItems);
+    }
+
+    d->queueTimer.invalidate();
+}
+
 } // namespace Digikam
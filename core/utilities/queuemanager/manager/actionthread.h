@@ -25,6 +25,10 @@
 #ifndef DIGIKAM_BQM_ACTION_THREAD_H
 #define DIGIKAM_BQM_ACTION_THREAD_H
 
+// Qt includes
+
+#include <QStringList>
+
 // Local includes
 
 #include "batchtool.h"
@@ -50,6 +54,11 @@ public:
 
     void processQueueItems(const QList<AssignedBatchTools>& items);
 
+    /** Return the timing report of the last processed queue: the throughput and the time
+     *  spent by each tool. It's built when the queue is fully processed.
+     */
+    QStringList timingReport() const;
+
     void cancel();
 
 Q_SIGNALS:
@@ -75,6 +84,10 @@ private Q_SLOTS:
     void slotUpdateItemInfo(const Digikam::ActionData& ad);
     void slotThreadFinished();
 
+private:
+
+    void buildTimingReport();
+
 private:
 
     class Private;
@@ -399,13 +399,27 @@ bool BatchTool::loadToDImg() const
 
 bool BatchTool::savefromDImg() const
 {
-    if (!isLastChainedTool() && outputSuffix().isEmpty())
+    if (!isLastChainedTool())
     {
+        if (!outputSuffix().isEmpty())
+        {
+            // A converter in the middle of the chain: keep the image in memory and let
+            // the last tool encode it with the target format and the attributes set here.
+            d->image.setAttribute(QLatin1String("batchToolOutputFormat"), outputSuffix().toUpper());
+        }
+
         return true;
     }
 
     DImg::FORMAT detectedFormat = d->image.detectedFormat();
     QString frm                 = outputSuffix().toUpper();
+
+    if (frm.isEmpty() && d->image.hasAttribute(QLatin1String("batchToolOutputFormat")))
+    {
+        frm = d->image.attribute(QLatin1String("batchToolOutputFormat")).toString();
+    }
+
+    d->image.removeAttribute(QLatin1String("batchToolOutputFormat"));
     bool resetOrientation       = getResetExifOrientationAllowed() &&
                                   (getNeedResetExifOrientation() || detectedFormat == DImg::RAW);
 
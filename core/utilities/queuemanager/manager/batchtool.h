@@ -148,6 +148,8 @@ public:
         - output Url set by setOutputUrl() or setOutputUrlFromInputUrl()
         - output file format set by outputSuffix(). If this one is empty,
           format of original image is used instead.
+        If the tool is not the last chained one, nothing is written: the image is passed
+        in memory to the next tool, which will use the output format of this one if any.
      */
     bool savefromDImg() const;
 
@@ -203,6 +205,12 @@ public:
      */
     virtual int toolVersion() const { return 1; };
 
+    /** Re-implement this method and return true if tool operations run sub-threads to process an image,
+        as filters parallelized with QtConcurrent. This is used to schedule items processed in parallel.
+        This method return false by default.
+     */
+    virtual bool isMultithreaded() const { return false; };
+
     /** Re-implement this method is you want customize cancellation of tool, for ex. to call
         a dedicated method to kill sub-threads parented to this tool instance.
         Unforget to call parent BatchTool::cancel() method in your customized implementation.
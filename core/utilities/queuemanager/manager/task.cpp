@@ -27,6 +27,7 @@
 // Qt includes
 
 #include <QFileInfo>
+#include <QElapsedTimer>
 
 // KDE includes
 
@@ -37,6 +38,7 @@
 #include "digikam_debug.h"
 #include "digikam_config.h"
 #include "dimg.h"
+#include "dimagehistory.h"
 #include "dmetadata.h"
 #include "iteminfo.h"
 #include "batchtool.h"
@@ -56,12 +58,77 @@ public:
         tool   = 0;
     }
 
+    /**
+     * Return true if the tool at index in the chain must save its result to a file,
+     * i.e. it is the last one or the next tool works on files (user script).
+     */
+    bool isLastChainedTool(int index) const
+    {
+        if (index + 1 >= tools.m_toolsList.count())
+        {
+            return true;
+        }
+
+        return (tools.m_toolsList[index + 1].group == BatchTool::CustomTool);
+    }
+
+    /**
+     * Return true if the tool only changes each pixel from its own value, without
+     * looking at the neighbours or at the whole image statistics. Such tools can be
+     * applied band by band over the image.
+     */
+    bool isPixelTool(const BatchToolSet& set) const
+    {
+        if (set.group != BatchTool::ColorTool)
+        {
+            return false;
+        }
+
+        return (set.name == QLatin1String("BCGCorrection") ||
+                set.name == QLatin1String("ColorBalance")  ||
+                set.name == QLatin1String("CurvesAdjust")  ||
+                set.name == QLatin1String("HSLCorrection") ||
+                set.name == QLatin1String("ChannelMixer")  ||
+                set.name == QLatin1String("Invert"));
+    }
+
+    /**
+     * Return the number of tools starting at index which are fused in a single pass:
+     * all adjacent per-pixel colour tools, or only the tool itself.
+     */
+    int fusedRunLength(int index) const
+    {
+        int length = 1;
+
+        if (!isPixelTool(tools.m_toolsList[index]))
+        {
+            return length;
+        }
+
+        while (((index + length) < tools.m_toolsList.count()) &&
+               !isLastChainedTool(index + length - 1)          &&
+               isPixelTool(tools.m_toolsList[index + length]))
+        {
+            ++length;
+        }
+
+        return length;
+    }
+
+public:
+
+    /// Size in bytes of the image bands processed by fused per-pixel tools.
+    static const int   fusedBandBytes = 4 * 1024 * 1024;
+
     bool               cancel;
 
     BatchTool*         tool;
 
     QueueSettings      settings;
     AssignedBatchTools tools;
+
+    /// Time spent in milliseconds by each tool, reported with the item status.
+    QMap<QString, qint64> toolTimes;
 };
 
 // -------------------------------------------------------
@@ -113,13 +180,86 @@ void Task::removeTempFiles(const QList<QUrl>& tmpList)
 void Task::emitActionData(ActionData::ActionStatus st, const QString& mess, const QUrl& dest)
 {
     ActionData ad;
-    ad.fileUrl = d->tools.m_itemUrl;
-    ad.status  = st;
-    ad.message = mess;
-    ad.destUrl = dest;
+    ad.fileUrl   = d->tools.m_itemUrl;
+    ad.status    = st;
+    ad.message   = mess;
+    ad.destUrl   = dest;
+    ad.toolTimes = d->toolTimes;
     emit signalFinished(ad);
 }
 
+bool Task::applyFusedTools(const QList<BatchTool*>& chain, DImg& image, QString& errMsg)
+{
+    BatchTool* const first = chain.first();
+    BatchTool* const last  = chain.last();
+    const bool lastChained = last->isLastChainedTool();
+
+    d->tool = first;
+
+    if (!first->loadToDImg())
+    {
+        errMsg = first->errorDescription();
+        return false;
+    }
+
+    image                = first->imageData();
+    const int rowBytes   = image.width() * image.bytesDepth();
+    const int bandHeight = qMax(1, Private::fusedBandBytes / qMax(1, rowBytes));
+    DImageHistory history;
+
+    // Each band of the image goes through all tools while it is still in the CPU cache.
+    // The last tool must not save the bands, it saves the whole image afterwards.
+
+    last->setLastChainedTool(false);
+
+    for (int y = 0 ; y < (int)image.height() ; y += bandHeight)
+    {
+        DImg band = image.copy(0, y, image.width(), qMin(bandHeight, (int)image.height() - y));
+
+        foreach (BatchTool* const tool, chain)
+        {
+            d->tool = tool;
+            tool->setImageData(band);
+
+            QElapsedTimer timer;
+            timer.start();
+
+            if (!tool->apply() || d->cancel)
+            {
+                errMsg = tool->errorDescription();
+                return false;
+            }
+
+            d->toolTimes[tool->toolTitle()] += timer.elapsed();
+            band = tool->imageData();
+        }
+
+        image.bitBltImage(&band, 0, y);
+
+        if (y == 0)
+        {
+            // All bands get the same filter actions, use the first one to fill the history.
+            history = band.getItemHistory();
+        }
+    }
+
+    image.setItemHistory(history);
+
+    d->tool = last;
+    last->setLastChainedTool(lastChained);
+    last->setImageData(image);
+
+    bool ret = last->savefromDImg();
+    image    = last->imageData();
+
+    if (!ret)
+    {
+        errMsg = last->errorDescription();
+    }
+
+    return ret;
+}
+
 void Task::run()
 {
     if (d->cancel)
@@ -145,54 +285,67 @@ void Task::run()
     ItemInfo source = ItemInfo::fromUrl(d->tools.m_itemUrl);
     bool timeAdjust  = false;
 
-    foreach (const BatchToolSet& set, d->tools.m_toolsList)
+    // The image is handed in memory from one tool to the next one. Only the tools which
+    // end the chain, or which precede a tool working on files, write their result to disk.
+
+    while (index < d->tools.m_toolsList.count())
     {
-        d->tool     = BatchToolsFactory::instance()->findTool(set.name, set.group)->clone();
-        timeAdjust |= (set.name == QLatin1String("TimeAdjust"));
-        inUrl       = outUrl;
-        index       = set.index + 1;
-
-        qCDebug(DIGIKAM_GENERAL_LOG) << "Tool : index= " << index
-                 << " :: name= "     << set.name
-                 << " :: group= "    << set.group
-                 << " :: wurl= "     << workUrl;
-
-        d->tool->setImageData(tmpImage);
-        d->tool->setItemInfo(source);
-        d->tool->setInputUrl(inUrl);
-        d->tool->setWorkingUrl(workUrl);
-        d->tool->setSettings(set.settings);
-        d->tool->setIOFileSettings(d->settings.ioFileSettings);
-        d->tool->setRawLoadingRules(d->settings.rawLoadingRule);
-        d->tool->setDRawDecoderSettings(d->settings.rawDecodingSettings);
-        d->tool->setResetExifOrientationAllowed(d->settings.exifSetOrientation);
-
-        if (index == d->tools.m_toolsList.count())
+        const int runLength = d->fusedRunLength(index);
+        inUrl               = outUrl;
+
+        QList<BatchTool*> chain;
+
+        for (int i = index ; i < index + runLength ; ++i)
         {
-            d->tool->setLastChainedTool(true);
+            const BatchToolSet& set = d->tools.m_toolsList[i];
+            BatchTool* const tool   = BatchToolsFactory::instance()->findTool(set.name, set.group)->clone();
+            timeAdjust             |= (set.name == QLatin1String("TimeAdjust"));
+
+            qCDebug(DIGIKAM_GENERAL_LOG) << "Tool : index= " << set.index + 1
+                     << " :: name= "     << set.name
+                     << " :: group= "    << set.group
+                     << " :: wurl= "     << workUrl;
+
+            tool->setImageData(tmpImage);
+            tool->setItemInfo(source);
+            tool->setInputUrl(inUrl);
+            tool->setWorkingUrl(workUrl);
+            tool->setSettings(set.settings);
+            tool->setIOFileSettings(d->settings.ioFileSettings);
+            tool->setRawLoadingRules(d->settings.rawLoadingRule);
+            tool->setDRawDecoderSettings(d->settings.rawDecodingSettings);
+            tool->setResetExifOrientationAllowed(d->settings.exifSetOrientation);
+            tool->setLastChainedTool(d->isLastChainedTool(i));
+            tool->setBranchHistory(true);
+
+            chain << tool;
         }
-        // If the next tool is under the custom group (user script)
-        // treat as the last chained tool, i.e. save image to file
-        else if (d->tools.m_toolsList[index].group == BatchTool::CustomTool)
+
+        index  += runLength;
+        d->tool = chain.last();
+        d->tool->setOutputUrlFromInputUrl();
+        outUrl  = d->tool->outputUrl();
+
+        if (chain.count() == 1)
         {
-            d->tool->setLastChainedTool(true);
+            QElapsedTimer timer;
+            timer.start();
+
+            success  = d->tool->apply();
+            tmpImage = d->tool->imageData();
+            errMsg   = d->tool->errorDescription();
+
+            d->toolTimes[d->tool->toolTitle()] += timer.elapsed();
         }
         else
         {
-            d->tool->setLastChainedTool(false);
+            success  = applyFusedTools(chain, tmpImage, errMsg);
         }
 
-        d->tool->setOutputUrlFromInputUrl();
-        d->tool->setBranchHistory(true);
-
-        outUrl   = d->tool->outputUrl();
-        success  = d->tool->apply();
-        tmpImage = d->tool->imageData();
-        errMsg   = d->tool->errorDescription();
         tmp2del.append(outUrl);
 
-        delete d->tool;
         d->tool = 0;
+        qDeleteAll(chain);
 
         if (d->cancel)
         {
@@ -39,6 +39,9 @@
 namespace Digikam
 {
 
+class DImg;
+class BatchTool;
+
 class Task : public ActionJob
 {
     Q_OBJECT
@@ -66,6 +69,12 @@ protected:
 
 private:
 
+    /**
+     * Apply a chain of per-pixel tools in a single pass over the image, band by band.
+     * The result is stored in image and saved by the last tool if it ends the chain.
+     */
+    bool applyFusedTools(const QList<BatchTool*>& chain, DImg& image, QString& errMsg);
+
     void removeTempFiles(const QList<QUrl>& tmpList);
     void emitActionData(ActionData::ActionStatus st,
                         const QString& mess=QString(),
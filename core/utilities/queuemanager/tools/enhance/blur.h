@@ -43,6 +43,8 @@ public:
 
     BatchTool* clone(QObject* const parent=0) const { return new Blur(parent); };
 
+    bool isMultithreaded() const { return true; };
+
     void registerSettingsWidget();
 
 private:
@@ -42,6 +42,8 @@ public:
 
     BatchTool* clone(QObject* const parent=0) const { return new LensAutoFix(parent); };
 
+    bool isMultithreaded() const { return true; };
+
     void registerSettingsWidget();
 
 private:
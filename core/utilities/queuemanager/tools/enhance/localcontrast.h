@@ -46,6 +46,8 @@ public:
 
     BatchTool* clone(QObject* const parent=0) const { return new LocalContrast(parent); };
 
+    bool isMultithreaded() const { return true; };
+
     void registerSettingsWidget();
 
 private:
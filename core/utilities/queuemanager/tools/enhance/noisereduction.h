@@ -46,6 +46,8 @@ public:
 
     BatchTool* clone(QObject* const parent=0) const { return new NoiseReduction(parent); };
 
+    bool isMultithreaded() const { return true; };
+
     void registerSettingsWidget();
 
 private:
@@ -47,6 +47,8 @@ public:
 
     BatchTool* clone(QObject* const parent=0) const { return new Restoration(parent); };
 
+    bool isMultithreaded() const { return true; };
+
     void registerSettingsWidget();
 
     void cancel();
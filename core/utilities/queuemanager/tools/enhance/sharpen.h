@@ -45,6 +45,8 @@ public:
 
     BatchTool* clone(QObject* const parent=0) const { return new Sharpen(parent); };
 
+    bool isMultithreaded() const { return true; };
+
     void registerSettingsWidget();
 
 private:
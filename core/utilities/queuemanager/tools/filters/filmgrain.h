@@ -44,6 +44,8 @@ public:
 
     BatchTool* clone(QObject* const parent=0) const { return new FilmGrain(parent); };
 
+    bool isMultithreaded() const { return true; };
+
     void registerSettingsWidget();
 
 private:
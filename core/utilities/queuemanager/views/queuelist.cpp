@@ -683,6 +683,14 @@ void QueueListView::slotAddItems(const ItemInfoList& list)
         return;
     }
 
+    // Warm the ItemInfo cache in one go for the properties used by the queue items,
+    // the renaming rules and the tooltips, instead of one query per item and field.
+
+    DatabaseFields::Set fields;
+    fields |= DatabaseFields::FileSize | DatabaseFields::ModificationDate;
+    fields |= DatabaseFields::CreationDate | DatabaseFields::Format | DatabaseFields::Width | DatabaseFields::Height;
+    list.loadDatabaseFields(fields);
+
     for (ItemInfoList::ConstIterator it = list.begin(); it != list.end(); ++it)
     {
         ItemInfo info = *it;
@@ -87,6 +87,7 @@ public:
         previewShowIcons(0),
         showFolderTreeViewItemsCount(0),
         largeThumbsBox(0),
+        videoSmartThumbsBox(0),
         iconTreeThumbSize(0),
         leftClickActionComboBox(0),
         tab(0),
@@ -125,6 +126,7 @@ public:
     QCheckBox*          previewShowIcons;
     QCheckBox*          showFolderTreeViewItemsCount;
     QCheckBox*          largeThumbsBox;
+    QCheckBox*          videoSmartThumbsBox;
 
     QComboBox*          iconTreeThumbSize;
     QComboBox*          leftClickActionComboBox;
@@ -225,6 +227,12 @@ SetupAlbumView::SetupAlbumView(QWidget* const parent)
                                          "digiKam needs to be restarted to take effect, and Rebuild Thumbnails option from Maintenance tool "
                                          "needs to be processed over whole collections."));
 
+    d->videoSmartThumbsBox = new QCheckBox(i18n("Select a representative frame for video thumbnails"), iwpanel);
+    d->videoSmartThumbsBox->setWhatsThis(i18n("Set this option to take new video thumbnails from the most representative "
+                                              "of the first key frames, instead of the first decoded frame.\n"
+                                              "By default this option is turned off. When this option is enabled, up to 25 key frames "
+                                              "are decoded for each new video thumbnail, which takes more time."));
+
     grid->addWidget(d->iconShowNameBox,          0, 0, 1, 1);
     grid->addWidget(d->iconShowSizeBox,          1, 0, 1, 1);
     grid->addWidget(d->iconShowDateBox,          2, 0, 1, 1);
@@ -245,9 +253,10 @@ SetupAlbumView::SetupAlbumView(QWidget* const parent)
     grid->addWidget(d->leftClickActionComboBox,  7, 1, 1, 1);
     grid->addWidget(d->iconViewFontSelect,       8, 0, 1, 2);
     grid->addWidget(d->largeThumbsBox,           9, 0, 1, 2);
+    grid->addWidget(d->videoSmartThumbsBox,     10, 0, 1, 2);
     grid->setContentsMargins(spacing, spacing, spacing, spacing);
     grid->setSpacing(spacing);
-    grid->setRowStretch(10, 10);
+    grid->setRowStretch(11, 10);
 
     d->tab->insertTab(IconView, iwpanel, i18nc("@title:tab", "Icons"));
 
@@ -393,6 +402,7 @@ void SetupAlbumView::applySettings()
     settings->setIconShowComments(d->iconShowCommentsBox->isChecked());
     settings->setIconShowOverlays(d->iconShowOverlaysBox->isChecked());
     settings->setIconShowFullscreen(d->iconShowFullscreenBox->isChecked());
+    settings->setVideoSmartThumbnails(d->videoSmartThumbsBox->isChecked());
     settings->setIconShowCoordinates(d->iconShowCoordinatesBox->isChecked());
     settings->setIconShowRating(d->iconShowRatingBox->isChecked());
     settings->setIconShowImageFormat(d->iconShowFormatBox->isChecked());
@@ -470,6 +480,7 @@ void SetupAlbumView::readSettings()
     d->iconShowCoordinatesBox->setChecked(settings->getIconShowCoordinates());
     d->iconShowRatingBox->setChecked(settings->getIconShowRating());
     d->iconShowFormatBox->setChecked(settings->getIconShowImageFormat());
+    d->videoSmartThumbsBox->setChecked(settings->getVideoSmartThumbnails());
     d->iconViewFontSelect->setFont(settings->getIconViewFont());
 
     d->leftClickActionComboBox->setCurrentIndex((int)settings->getItemLeftClickAction());